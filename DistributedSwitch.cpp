@@ -0,0 +1,61 @@
+/**
+ * @file DistributedSwitch.cpp
+ * @brief Implementation of the DistributedSwitch class.
+ *
+ * Generates and routes requests in lookahead windows and forwards each window
+ * to the remote load balancer nodes.
+ */
+
+#include "DistributedSwitch.h"
+#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+
+DistributedSwitch::DistributedSwitch(RemoteLoadBalancer* streamLB, RemoteLoadBalancer* processLB, int lookaheadCycles) {
+    streamingLB = streamLB;
+    processingLB = processLB;
+    lookahead = lookaheadCycles;
+}
+
+void DistributedSwitch::routeRequest(const Request& req, int cycle) {
+    if (req.jobType == 'S') {
+        streamingLB->addRequest(req, cycle);
+    }
+    else if (req.jobType == 'P') {
+        processingLB->addRequest(req, cycle);
+    }
+}
+
+void DistributedSwitch::run(int totalCycles) {
+    for (int windowStart = 0; windowStart < totalCycles; windowStart += lookahead) {
+        int windowLength = std::min(lookahead, totalCycles - windowStart);
+        for (int i = windowStart; i < windowStart + windowLength; i++) {
+            if (rand() % 100 < 40) { // 40% chance of new request
+                Request r;
+                routeRequest(r, i);
+            }
+        }
+        streamingLB->sendWindow(windowStart, windowLength);
+        processingLB->sendWindow(windowStart, windowLength);
+
+        // let each node work on one window while the next one is queued
+        while (streamingLB->getWindowsInFlight() > 1) {
+            streamingLB->waitForWindow();
+        }
+        while (processingLB->getWindowsInFlight() > 1) {
+            processingLB->waitForWindow();
+        }
+    }
+
+    RemoteSummary streaming = streamingLB->finish(totalCycles);
+    RemoteSummary processing = processingLB->finish(totalCycles);
+
+    std::cout << "\n===== Distributed Run Summary =====\n";
+    std::cout << "Lookahead Window: " << lookahead << " Clock Cycles\n";
+    std::cout << "Total Processed: " << streaming.processed + processing.processed
+              << " (streaming " << streaming.processed << ", processing " << processing.processed << ")\n";
+    std::cout << "Total Blocked (Firewall): " << streaming.blocked + processing.blocked << "\n";
+    std::cout << "Final Server Count: " << streaming.finalServers + processing.finalServers
+              << " (streaming " << streaming.finalServers << ", processing " << processing.finalServers << ")\n";
+    std::cout << "Ending Request Queue Size: " << streaming.queueSize + processing.queueSize << "\n";
+}
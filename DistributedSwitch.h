@@ -0,0 +1,56 @@
+#ifndef DISTRIBUTEDSWITCH_H
+#define DISTRIBUTEDSWITCH_H
+
+#include "RemoteLoadBalancer.h"
+#include "Request.h"
+
+/**
+ * @brief Routes requests to load balancers running in other processes or hosts.
+ *
+ * The distributed counterpart of Switch. Requests are generated and routed the
+ * same way, but instead of stepping local load balancers each cycle, routed
+ * requests are batched per lookahead window and forwarded to LBNode processes.
+ *
+ * Time synchronization is conservative: a window is only sent once every
+ * request in it is known, so a node may simulate the whole window without
+ * waiting on the switch. The switch keeps at most two windows in flight per
+ * node, so nodes always have the next window queued while bounding how far the
+ * switch runs ahead.
+ */
+class DistributedSwitch {
+    private:
+        RemoteLoadBalancer* streamingLB;    ///< Node handling streaming requests ('S' jobs)
+        RemoteLoadBalancer* processingLB;   ///< Node handling processing requests ('P' jobs)
+        int lookahead;                      ///< Cycles per synchronization window
+
+    public:
+        /**
+         * @brief Constructs a new DistributedSwitch over two connected nodes.
+         *
+         * @param streamLB Proxy for the streaming load balancer node
+         * @param processLB Proxy for the processing load balancer node
+         * @param lookaheadCycles Cycles per synchronization window (1 to 65535)
+         */
+        DistributedSwitch(RemoteLoadBalancer* streamLB, RemoteLoadBalancer* processLB, int lookaheadCycles);
+
+        /**
+         * @brief Routes a request to the node for its job type.
+         *
+         * @param req The request to be routed
+         * @param cycle Simulation cycle the request arrives in
+         */
+        void routeRequest(const Request& req, int cycle);
+
+        /**
+         * @brief Executes the distributed simulation.
+         *
+         * Each cycle has a 40% chance of a new request, as in Switch::run().
+         * After the last window, the nodes print their own summaries and the
+         * switch prints the combined totals.
+         *
+         * @param totalCycles Number of clock cycles to run the simulation
+         */
+        void run(int totalCycles);
+};
+
+#endif
@@ -0,0 +1,120 @@
+/**
+ * @file EventLog.cpp
+ * @brief Implementation of the binary event log writer and reader.
+ *
+ * Handles the file header and block-wise buffered I/O for fixed-size event records.
+ */
+
+#include "EventLog.h"
+#include <cstring>
+
+static const char EVENT_LOG_MAGIC[4] = {'L', 'B', 'E', 'V'};
+static const uint32_t EVENT_LOG_VERSION = 1;
+
+EventLog::EventLog(const std::string& fileName, size_t bufferRecords) {
+    buffer.resize(bufferRecords > 0 ? bufferRecords : 1);
+    used = 0;
+    writeFailed = false;
+    file = std::fopen(fileName.c_str(), "wb");
+    if (file == nullptr) {
+        return;
+    }
+
+    EventLogHeader header;
+    std::memcpy(header.magic, EVENT_LOG_MAGIC, sizeof(header.magic));
+    header.version = EVENT_LOG_VERSION;
+    header.recordSize = sizeof(EventRecord);
+    header.reserved = 0;
+    if (std::fwrite(&header, sizeof(header), 1, file) != 1) {
+        writeFailed = true;
+    }
+}
+
+EventLog::~EventLog() {
+    close();
+}
+
+bool EventLog::isOpen() const {
+    return file != nullptr;
+}
+
+bool EventLog::flush() {
+    if (file != nullptr && used > 0) {
+        if (std::fwrite(buffer.data(), sizeof(EventRecord), used, file) != used) {
+            writeFailed = true;
+        }
+        if (std::fflush(file) != 0) {
+            writeFailed = true;
+        }
+    }
+    used = 0;
+    return !writeFailed;
+}
+
+bool EventLog::good() const {
+    return !writeFailed;
+}
+
+bool EventLog::close() {
+    if (file == nullptr) {
+        return !writeFailed;
+    }
+    flush();
+    if (std::fclose(file) != 0) {
+        writeFailed = true;
+    }
+    file = nullptr;
+    return !writeFailed;
+}
+
+EventLogReader::EventLogReader(const std::string& fileName) {
+    buffer.resize(65536);
+    used = 0;
+    position = 0;
+    file = std::fopen(fileName.c_str(), "rb");
+    if (file == nullptr) {
+        errorMessage = "cannot open " + fileName;
+        return;
+    }
+
+    EventLogHeader header;
+    if (std::fread(&header, sizeof(header), 1, file) != 1 ||
+        std::memcmp(header.magic, EVENT_LOG_MAGIC, sizeof(header.magic)) != 0) {
+        errorMessage = fileName + " is not an event log";
+    } else if (header.version != EVENT_LOG_VERSION || header.recordSize != sizeof(EventRecord)) {
+        errorMessage = fileName + " has unsupported format version " + std::to_string(header.version);
+    }
+    if (!errorMessage.empty()) {
+        std::fclose(file);
+        file = nullptr;
+    }
+}
+
+EventLogReader::~EventLogReader() {
+    if (file != nullptr) {
+        std::fclose(file);
+    }
+}
+
+bool EventLogReader::isOpen() const {
+    return file != nullptr;
+}
+
+const std::string& EventLogReader::error() const {
+    return errorMessage;
+}
+
+bool EventLogReader::next(EventRecord& record) {
+    if (position == used) {
+        if (file == nullptr) {
+            return false;
+        }
+        used = std::fread(buffer.data(), sizeof(EventRecord), buffer.size(), file);
+        position = 0;
+        if (used == 0) {
+            return false;
+        }
+    }
+    record = buffer[position++];
+    return true;
+}
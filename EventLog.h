@@ -0,0 +1,170 @@
+#ifndef EVENTLOG_H
+#define EVENTLOG_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Kinds of events recorded in a binary event log.
+ */
+enum EventType : uint8_t {
+    EVENT_QUEUE_START = 1,  ///< Initial queue generated. detail: LB type ('S'/'P'), payload: queue size
+    EVENT_SCALE_UP = 2,     ///< Server added. detail: server class index, payload: new server count
+    EVENT_SCALE_DOWN = 3,   ///< Server removed. detail: server class index, payload: new server count
+    EVENT_BLOCKED = 4,      ///< Request dropped by the firewall. payload: packed source IPv4 address
+    EVENT_DISPATCHED = 5,   ///< Request assigned to a server. detail: server class index, payload: timeRequired
+    EVENT_COMPLETED = 6,    ///< Server finished its request. detail: server class index, payload: server id
+    EVENT_RUN_END = 7       ///< Simulation finished. payload: final server count
+};
+
+/**
+ * @brief One fixed-size record in a binary event log.
+ *
+ * Records are written in the host's byte order (little-endian on all supported
+ * platforms) exactly as laid out here, 16 bytes each.
+ */
+struct EventRecord {
+    uint64_t cycle;     ///< Simulation clock cycle the event happened in
+    uint16_t lbId;      ///< Identifier of the load balancer that produced the event
+    uint8_t type;       ///< One of EventType
+    uint8_t detail;     ///< Small event-specific value (see EventType)
+    uint32_t payload;   ///< Event-specific value (see EventType)
+};
+
+static_assert(sizeof(EventRecord) == 16, "EventRecord must stay 16 bytes");
+
+/**
+ * @brief Header at the start of every binary event log file.
+ */
+struct EventLogHeader {
+    char magic[4];          ///< Always "LBEV"
+    uint32_t version;       ///< Format version, currently 1
+    uint32_t recordSize;    ///< sizeof(EventRecord), checked by readers
+    uint32_t reserved;      ///< Zero
+};
+
+/**
+ * @brief Buffered writer for binary event logs.
+ *
+ * Records are collected in memory and written in large blocks, so recording an
+ * event costs a struct copy rather than string formatting and a stream write.
+ * Several load balancers may share one log; records carry the load balancer id.
+ */
+class EventLog {
+private:
+    std::FILE* file;                    ///< Output file, nullptr if opening failed
+    std::vector<EventRecord> buffer;    ///< Records not yet written to the file
+    size_t used;                        ///< Number of valid records in buffer
+    bool writeFailed;                   ///< Set once any write to the file has failed
+
+public:
+    /**
+     * @brief Opens (truncating) the log file and writes the header.
+     *
+     * @param fileName Path to the binary log file
+     * @param bufferRecords Number of records buffered between writes
+     */
+    explicit EventLog(const std::string& fileName, size_t bufferRecords = 65536);
+
+    /**
+     * @brief Closes the file if close() was not called; errors are then lost.
+     */
+    ~EventLog();
+
+    /**
+     * @brief Checks whether the log file was opened successfully.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Appends one event to the log.
+     *
+     * @param cycle Simulation clock cycle
+     * @param lbId Load balancer identifier
+     * @param type One of EventType
+     * @param detail Small event-specific value
+     * @param payload Event-specific value
+     */
+    void record(uint64_t cycle, uint16_t lbId, uint8_t type, uint8_t detail, uint32_t payload) {
+        if (used == buffer.size()) {
+            flush();
+        }
+        EventRecord& r = buffer[used++];
+        r.cycle = cycle;
+        r.lbId = lbId;
+        r.type = type;
+        r.detail = detail;
+        r.payload = payload;
+    }
+
+    /**
+     * @brief Writes all buffered records to the file.
+     *
+     * @return bool False if this or any earlier write failed
+     */
+    bool flush();
+
+    /**
+     * @brief Checks that every write so far succeeded (e.g. the disk is not full).
+     */
+    bool good() const;
+
+    /**
+     * @brief Flushes buffered records and closes the file.
+     *
+     * @return bool False if any write or the close failed, in which case the
+     * file on disk is incomplete
+     */
+    bool close();
+};
+
+/**
+ * @brief Streaming reader for binary event logs.
+ *
+ * Reads records in large blocks and hands them out one at a time, so files far
+ * larger than memory can be analyzed.
+ */
+class EventLogReader {
+private:
+    std::FILE* file;                    ///< Input file, nullptr if opening failed
+    std::vector<EventRecord> buffer;    ///< Block of records read from the file
+    size_t used;                        ///< Number of valid records in buffer
+    size_t position;                    ///< Next record to hand out
+    std::string errorMessage;           ///< Reason the file could not be read
+
+public:
+    /**
+     * @brief Opens the log file and validates its header.
+     *
+     * @param fileName Path to the binary log file
+     */
+    explicit EventLogReader(const std::string& fileName);
+
+    /**
+     * @brief Closes the file.
+     */
+    ~EventLogReader();
+
+    /**
+     * @brief Checks whether the file was opened and has a valid header.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Describes why the file could not be opened.
+     */
+    const std::string& error() const;
+
+    /**
+     * @brief Reads the next record.
+     *
+     * @param record Receives the record
+     * @return true if a record was read
+     * @return false at end of file
+     */
+    bool next(EventRecord& record);
+};
+
+#endif
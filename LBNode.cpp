@@ -0,0 +1,13 @@
+/**
+ * @file LBNode.cpp
+ * @brief Explicit instantiations of the LBNode class template.
+ *
+ * An LBNode decodes request batches from the switch and advances its load
+ * balancer through each lookahead window. Its member definitions live in
+ * LBNode.h; the simulator's two load balancer types are instantiated here once.
+ */
+
+#include "LBNode.h"
+
+template class LBNode<LoadBalancer>;
+template class LBNode<BinaryLogLoadBalancer>;
@@ -0,0 +1,120 @@
+#ifndef LBNODE_H
+#define LBNODE_H
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include "LoadBalancer.h"
+#include "Transport.h"
+
+/**
+ * @brief Runs one LoadBalancer as a node of a distributed simulation.
+ *
+ * The node listens on an endpoint, accepts a single DistributedSwitch
+ * connection and then simulates its load balancer one lookahead window at a
+ * time: for each window it receives every request routed to it within the
+ * window, runs the window's cycles, and acknowledges. The node never runs past
+ * the last window it was given, so results do not depend on network timing.
+ *
+ * @tparam LB Load balancer type (LoadBalancer or BinaryLogLoadBalancer)
+ */
+template <class LB>
+class LBNode {
+private:
+    LB* loadBalancer;               ///< The load balancer simulated by this node
+    std::string endpoint;           ///< Where to listen for the switch
+    int startingServers;            ///< Server count before the run, for the summary
+
+public:
+    /**
+     * @brief Constructs a node for a load balancer.
+     *
+     * The load balancer's current server count is reported as the starting count
+     * in its summary, so the node must be constructed before the run begins.
+     *
+     * @param lb Load balancer to simulate (its initial queue should already be generated)
+     * @param listenEndpoint "unix:/path" or "tcp:host:port"
+     */
+    LBNode(LB* lb, const std::string& listenEndpoint);
+
+    /**
+     * @brief Accepts the switch connection and simulates until the run finishes.
+     *
+     * Prints the load balancer summary when the switch ends the run.
+     * Throws std::runtime_error on socket or protocol errors.
+     */
+    void serve();
+};
+
+template <class LB>
+LBNode<LB>::LBNode(LB* lb, const std::string& listenEndpoint) {
+    loadBalancer = lb;
+    endpoint = listenEndpoint;
+    startingServers = lb->getServerCount();
+}
+
+template <class LB>
+void LBNode<LB>::serve() {
+    std::unique_ptr<Connection> connection(Connection::acceptOne(endpoint));
+    std::vector<uint8_t> payload;
+    uint64_t simulated = 0;
+
+    while (true) {
+        uint8_t type = connection->recvFrame(payload);
+        WireReader in(payload);
+
+        if (type == MSG_WINDOW) {
+            uint64_t windowStart = in.get64();
+            uint32_t windowLength = in.get32();
+            uint32_t count = in.get32();
+            if (windowStart != simulated) {
+                throw std::runtime_error("window received out of order");
+            }
+
+            // requests arrive sorted by cycle: run cycles up to each arrival, then queue it
+            uint32_t cycle = 0;
+            for (uint32_t i = 0; i < count; ++i) {
+                uint16_t offset = in.get16();
+                std::string ipIn = unpackIPv4(in.get32());
+                std::string ipOut = unpackIPv4(in.get32());
+                int timeRequired = in.get16();
+                char jobType = in.get8();
+                if (offset < cycle || offset >= windowLength) {
+                    throw std::runtime_error("request outside its window");
+                }
+                for (; cycle < offset; ++cycle) {
+                    loadBalancer->runOneCycle();
+                }
+                loadBalancer->addRequest(Request(ipIn, ipOut, timeRequired, jobType));
+            }
+            for (; cycle < windowLength; ++cycle) {
+                loadBalancer->runOneCycle();
+            }
+            simulated += windowLength;
+
+            WireWriter ack;
+            ack.put64(simulated);
+            connection->sendFrame(MSG_WINDOW_DONE, ack.data());
+        }
+        else if (type == MSG_FINISH) {
+            uint64_t totalCycles = in.get64();
+            loadBalancer->printSummary(totalCycles, startingServers);
+
+            WireWriter summary;
+            summary.put64(loadBalancer->getTotalProcessed());
+            summary.put64(loadBalancer->getTotalBlocked());
+            summary.put32(loadBalancer->getServerCount());
+            summary.put64(loadBalancer->getQueueSize());
+            connection->sendFrame(MSG_SUMMARY, summary.data());
+            return;
+        }
+        else {
+            throw std::runtime_error("unexpected message type " + std::to_string(type));
+        }
+    }
+}
+
+extern template class LBNode<LoadBalancer>;
+extern template class LBNode<BinaryLogLoadBalancer>;
+
+#endif
@@ -9,10 +9,11 @@
 #define RESET "\033[0m"
 
 #include <vector>
-#include <queue>
 #include <fstream>
 #include "Request.h"
 #include "WebServer.h"
+#include "ServerClass.h"
+#include "LoadBalancerPolicies.h"
 
 /**
  * @brief Manages dynamic load distribution across a pool of web servers.
@@ -29,24 +30,84 @@
  * - Performance metrics tracking (throughput, task time ranges)
  * - Detailed event logging
  * - Support for specialized workload types (streaming vs. processing)
+ * - Heterogeneous fleets with capacity-aware placement and cost-based scaling
+ *
+ * Dispatch, scaling, firewall, queueing and event recording are compile-time
+ * policies (see LoadBalancerPolicies.h), so the per-cycle loop calls them
+ * without virtual dispatch or runtime branching on the load balancer type or
+ * on whether a binary event log is attached. Member
+ * definitions live in LoadBalancerImpl.h, so any policy set with the same
+ * members can be instantiated; LoadBalancer.cpp instantiates the default set.
+ *
+ * @tparam Dispatch Chooses idle servers for requests (e.g. CapacityDispatch)
+ * @tparam Scaler Decides when and which servers to add or remove (e.g. CostAwareScaler)
+ * @tparam Firewall Decides which source addresses are blocked (e.g. PrefixFirewall)
+ * @tparam Queue Holds pending requests (e.g. FifoQueue)
+ * @tparam Events Records events (NullEventSink for the text log only, BinaryEventSink)
  */
-class LoadBalancer
+template <class Dispatch, class Scaler, class Firewall, class Queue, class Events = NullEventSink>
+class BasicLoadBalancer
 {
 private:
     std::vector<WebServer*> webservers;  ///< Pool of managed web servers
-    std::queue<Request> requestQueue;    ///< FIFO queue of pending requests
+    Queue requestQueue;                  ///< Queue of pending requests
+    Dispatch dispatch;                   ///< Index of idle servers used for placement
+    Scaler scaler;                       ///< Scaling thresholds, cooldown and class choice
+    Firewall firewall;                   ///< Source address filter
     std::ofstream logFile;               ///< Output file stream for event logging
     int currentTime;                     ///< Current simulation clock cycle
-    int coolDownCounter;                 ///< Cycles remaining before next scaling operation
-    int coolDownPeriod;                  ///< Minimum cycles between scaling operations
     int totalProcessed;                  ///< Total number of successfully processed requests
     int totalBlocked;                    ///< Total number of requests blocked by firewall
-    int minThreshold;                    ///< Queue size threshold for removing servers (50 * serverCount)
-    int maxThreshold;                    ///< Queue size threshold for adding servers (80 * serverCount)
     char lbType;                         ///< Load balancer type: 'S' for streaming, 'P' for processing
+    const char* typeName;                ///< "Streaming" or "Processing", chosen once from lbType
+    const char* typeColor;               ///< Console color for this load balancer's output
     int upperTaskTime;                   ///< Maximum task time encountered across all requests
     int lowerTaskTime;                   ///< Minimum task time encountered across all requests
 
+    std::vector<ServerClass> serverClasses;  ///< Server classes this load balancer can run
+    std::vector<int> classCounts;            ///< Number of running servers per class
+    int nextServerId;                        ///< Identifier handed to the next server created
+    double totalCapacity;                    ///< Sum of server speeds (request time processed per cycle)
+    double fleetCostPerCycle;                ///< Sum of costPerCycle across all running servers
+    double totalCost;                        ///< Accumulated fleet cost over the simulation
+
+    // Aggregates maintained on assign, complete, add and remove so that scaling
+    // and reporting never scan the server pool. The idle count is kept by the
+    // dispatch policy alongside its index.
+    int busyCount;                           ///< Servers processing a request
+    long long queuedWork;                    ///< Sum of timeRequired over the request queue
+    double inFlightWork;                     ///< Request time still to be processed on busy servers
+
+    Events events;                           ///< Event recording policy
+
+    /**
+     * @brief Pushes a request onto the queue and updates queue statistics.
+     */
+    void enqueue(const Request& req);
+
+    /**
+     * @brief Removes an idle server from the most expensive class that has one.
+     *
+     * @return int Class index of the removed server, or -1 if none was idle
+     */
+    int removeIdleServer();
+
+    /**
+     * @brief Passes an event for the current cycle to the event policy.
+     */
+    void recordEvent(uint8_t type, uint8_t detail, uint32_t payload) {
+        events.record(currentTime, type, detail, payload);
+    }
+
+    /**
+     * @brief Debug-build check that the incremental aggregates match a full recount.
+     *
+     * Recomputes idle/busy counts, capacity, cost, outstanding work and the idle
+     * index from scratch and asserts they agree with the maintained values.
+     * Compiled out when NDEBUG is defined.
+     */
+    void checkInvariants() const;
+
 public:
     /**
      * @brief Constructs a new LoadBalancer with specified configuration.
@@ -60,7 +121,22 @@ public:
      * @param logFileName Path to the log file for event recording
      * @param loadBalancerType Type identifier: 'S' for streaming, 'P' for processing
      */
-    LoadBalancer(int numServers, int cooldown, const std::string& logFileName, char loadBalancerType);
+    BasicLoadBalancer(int numServers, int cooldown, const std::string& logFileName, char loadBalancerType);
+
+    /**
+     * @brief Constructs a new LoadBalancer running a heterogeneous fleet.
+     *
+     * Creates initialCount servers for each class. The cheapest class per unit of
+     * work (among those matching this load balancer's job type or accepting any
+     * job) is used when scaling up; scaling down removes idle servers from the
+     * most expensive classes first.
+     *
+     * @param fleet Server classes available to this load balancer
+     * @param cooldown Number of clock cycles to wait between scaling operations
+     * @param logFileName Path to the log file for event recording
+     * @param loadBalancerType Type identifier: 'S' for streaming, 'P' for processing
+     */
+    BasicLoadBalancer(const std::vector<ServerClass>& fleet, int cooldown, const std::string& logFileName, char loadBalancerType);
     
     /**
      * @brief Destructor that cleans up all allocated web servers and closes log file.
@@ -68,7 +144,7 @@ public:
      * Deallocates all dynamically created WebServer instances and ensures the
      * log file is properly flushed and closed.
      */
-    ~LoadBalancer();
+    ~BasicLoadBalancer();
 
     /**
      * @brief Populates the request queue with initial workload.
@@ -92,9 +168,10 @@ public:
     /**
      * @brief Distributes queued requests to available servers.
      * 
-     * For each idle server, attempts to assign a request from the queue.
-     * Automatically filters and blocks requests from blacklisted IP addresses
-     * before assignment. Advances processing on all active servers by one cycle.
+     * Assigns queued requests to idle servers until either runs out, choosing
+     * each server through the dispatch policy. Automatically
+     * filters and blocks requests from blacklisted IP addresses before
+     * assignment. Advances processing on all active servers by one cycle.
      * Updates totalProcessed and totalBlocked counters.
      */
     void distributeRequests();
@@ -102,14 +179,15 @@ public:
     /**
      * @brief Dynamically scales server pool based on current load.
      * 
-     * Evaluates queue size against threshold values and adds/removes servers
-     * as needed. Scaling is subject to cooldown periods to prevent oscillation.
+     * Asks the scaling policy whether to add or remove a server this cycle and
+     * which class to use. With CostAwareScaler, thresholds scale with total
+     * capacity (the sum of server speeds) and changes are subject to a cooldown:
      * 
      * Scaling rules:
-     * - Add server if: queueSize > maxThreshold * serverCount
-     * - Remove server if: queueSize < minThreshold * serverCount AND serverCount > 1
+     * - Add server if: queueSize > 80 * totalCapacity
+     * - Remove server if: queueSize < 50 * totalCapacity AND serverCount > 1
      * 
-     * Logs all scaling operations and resets cooldown counter after each change.
+     * Logs all scaling operations and restarts the cooldown after each change.
      */
     void scaleServers();
     
@@ -129,8 +207,9 @@ public:
     /**
      * @brief Checks if an IP address should be blocked by the firewall.
      * 
-     * Currently blocks all IP addresses beginning with "10." (private network range).
-     * Logs blocked IPs and outputs colored warnings to console.
+     * Asks the firewall policy (by default, blocks all IP addresses beginning
+     * with "10.", the private network range). Logs blocked IPs and outputs
+     * colored warnings to console.
      * 
      * @param ip The IP address string to check
      * @return true if the IP should be blocked
@@ -141,17 +220,26 @@ public:
     /**
      * @brief Adds a new web server to the pool.
      * 
-     * Dynamically allocates and adds a new WebServer instance to expand capacity.
-     * Called by scaleServers() when load exceeds maximum threshold.
-     * Logs the addition event.
+     * Dynamically allocates and adds a new WebServer of the cheapest class per
+     * unit of work to expand capacity. Called by scaleServers() when load
+     * exceeds maximum threshold.
      */
     void addServer();
+
+    /**
+     * @brief Adds a new web server of a specific class to the pool.
+     *
+     * @param classIndex Index of the server class in this load balancer's fleet
+     */
+    void addServer(int classIndex);
     
     /**
      * @brief Removes an idle server from the pool.
      * 
-     * Searches for an idle server and removes it to reduce capacity.
-     * Only removes servers that are not currently processing requests.
+     * Removes an idle server from the most expensive class (per unit of work)
+     * that has one, to reduce capacity and cost. Only removes servers that are
+     * not currently processing requests. The server is swapped with the last
+     * pool entry, so removal never scans the pool.
      * Called by scaleServers() when load falls below minimum threshold.
      * 
      * @return true if a server was successfully removed
@@ -167,6 +255,20 @@ public:
      * @param message The event description to log
      */
     void logEvent(const std::string& message);
+
+    /**
+     * @brief Attaches the binary event log used by a BinaryEventSink.
+     *
+     * Events (queue start, scaling, blocked, dispatched, completed, run end)
+     * are written as fixed-size records instead of formatted text lines; the
+     * text log only receives the final summary. Several load balancers may share
+     * one log. The log must outlive this load balancer, and must be attached
+     * before generateInitialQueue(). Ignored with NullEventSink.
+     *
+     * @param log The binary event log to write to
+     * @param id Identifier stored in this load balancer's records
+     */
+    void setEventLog(EventLog* log, int id);
     
     /**
      * @brief Prints comprehensive performance summary to console and log file.
@@ -176,7 +278,9 @@ public:
      * - Throughput as percentage of total cycles
      * - Number of firewall-blocked requests
      * - Task time range (min to max)
-     * - Final server count
+     * - Final server count, broken down by server class
+     * - Busy and idle servers and outstanding work at the end of the run
+     * - Total fleet cost
      * - Ending queue size
      * 
      * Output is color-coded based on load balancer type and written to both
@@ -213,6 +317,41 @@ public:
      * multi-load-balancer configurations.
      */
     void printLBType();
+
+    /**
+     * @brief Returns the number of requests assigned to servers so far.
+     */
+    int getTotalProcessed() const;
+
+    /**
+     * @brief Returns the number of requests blocked by the firewall so far.
+     */
+    int getTotalBlocked() const;
+
+    /**
+     * @brief Returns the current number of servers.
+     */
+    int getServerCount() const;
+
+    /**
+     * @brief Returns the current number of queued requests.
+     */
+    int getQueueSize() const;
 };
 
-#endif
\ No newline at end of file
+/**
+ * @brief The simulator's load balancer: default policies, fully inlined, text log.
+ */
+typedef BasicLoadBalancer<CapacityDispatch, CostAwareScaler, PrefixFirewall, FifoQueue> LoadBalancer;
+
+/**
+ * @brief The simulator's load balancer writing its events to a binary EventLog.
+ */
+typedef BasicLoadBalancer<CapacityDispatch, CostAwareScaler, PrefixFirewall, FifoQueue, BinaryEventSink> BinaryLogLoadBalancer;
+
+extern template class BasicLoadBalancer<CapacityDispatch, CostAwareScaler, PrefixFirewall, FifoQueue>;
+extern template class BasicLoadBalancer<CapacityDispatch, CostAwareScaler, PrefixFirewall, FifoQueue, BinaryEventSink>;
+
+#include "LoadBalancerImpl.h"
+
+#endif
@@ -0,0 +1,392 @@
+/**
+ * @file LoadBalancerImpl.h
+ * @brief Member definitions of the BasicLoadBalancer class template.
+ *
+ * Implements dynamic load distribution, automatic server scaling, firewall filtering,
+ * and comprehensive performance tracking for a web server pool. Supports both
+ * streaming and processing workload specialization. Included at the end of
+ * LoadBalancer.h so that any policy combination can be instantiated; include
+ * LoadBalancer.h rather than this file.
+ */
+
+#ifndef LOADBALANCERIMPL_H
+#define LOADBALANCERIMPL_H
+
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <cassert>
+
+#define LB_TEMPLATE template <class Dispatch, class Scaler, class Firewall, class Queue, class Events>
+#define LB_CLASS BasicLoadBalancer<Dispatch, Scaler, Firewall, Queue, Events>
+
+LB_TEMPLATE
+LB_CLASS::BasicLoadBalancer(int numServers, int coolDown, const std::string& logFileName, char loadBalancerType)
+    : BasicLoadBalancer(std::vector<ServerClass>(1, ServerClass("standard", 1.0, 1.0, 'A', numServers)), coolDown, logFileName, loadBalancerType) {
+}
+
+LB_TEMPLATE
+LB_CLASS::BasicLoadBalancer(const std::vector<ServerClass>& fleet, int coolDown, const std::string& logFileName, char loadBalancerType) {
+    logFile.open(logFileName);
+    currentTime = 0;
+    lbType = loadBalancerType;
+    typeName = lbType == 'S' ? "Streaming" : "Processing";
+    typeColor = lbType == 'S' ? BLUE : PURPLE;
+
+    totalProcessed = 0;
+    totalBlocked = 0;
+
+    upperTaskTime = 0;
+    lowerTaskTime = std::numeric_limits<int>::max();
+
+    serverClasses = fleet;
+    classCounts.assign(serverClasses.size(), 0);
+    nextServerId = 0;
+    totalCapacity = 0;
+    fleetCostPerCycle = 0;
+    totalCost = 0;
+
+    busyCount = 0;
+    queuedWork = 0;
+    inFlightWork = 0;
+
+    dispatch.configure(serverClasses);
+    scaler.configure(serverClasses, lbType, coolDown);
+
+    for (int c = 0; c < (int)serverClasses.size(); ++c) {
+        for (int i = 0; i < serverClasses[c].initialCount; ++i) {
+            addServer(c);
+        }
+    }
+}
+
+LB_TEMPLATE
+LB_CLASS::~BasicLoadBalancer() {
+    for (auto webserver: webservers) {
+        delete webserver;
+    }
+    logFile.close();
+}
+
+LB_TEMPLATE
+void LB_CLASS::generateInitialQueue() {
+    int initSize = 100 * webservers.size(); // queue starts full (100 * number of servers)
+    for (int i = 0; i < initSize; ++i) {
+        Request r;
+        upperTaskTime = std::max(upperTaskTime, r.timeRequired);
+        lowerTaskTime = std::min(lowerTaskTime, r.timeRequired);
+        r.jobType = lbType;
+        enqueue(r);
+    }
+    printLBType();
+    std::cout << ORANGE << "Starting Queue Size: " RESET << std::to_string(requestQueue.size()) << "\n";
+    if (Events::binary) {
+        recordEvent(EVENT_QUEUE_START, lbType, requestQueue.size());
+    } else {
+        logEvent("Starting Queue Size: " + std::to_string(requestQueue.size()));
+    }
+}
+
+LB_TEMPLATE
+void LB_CLASS::generateRandomRequests() {
+    if (rand() % 100 < 30) { // 30% chance of new request
+        Request r;
+        upperTaskTime = std::max(upperTaskTime, r.timeRequired);
+        lowerTaskTime = std::min(lowerTaskTime, r.timeRequired);
+        enqueue(r);
+    }
+}
+
+LB_TEMPLATE
+void LB_CLASS::distributeRequests() {
+    while (true) {
+        // remove blocked IP addresses
+        while (!requestQueue.empty() && isBlockedIP(requestQueue.front().ipIn)) {
+            queuedWork -= requestQueue.front().timeRequired;
+            requestQueue.pop();
+            totalBlocked++;
+        }
+        if (requestQueue.empty() || dispatch.idleCount() == 0) {
+            break;
+        }
+        const Request& req = requestQueue.front();
+        WebServer* webserver = dispatch.takeIdle(req);
+        webserver->assignRequest(req);
+        recordEvent(EVENT_DISPATCHED, webserver->getClassIndex(), req.timeRequired);
+        queuedWork -= req.timeRequired;
+        inFlightWork += req.timeRequired;
+        busyCount++;
+        requestQueue.pop();
+        totalProcessed++;
+    }
+
+    for (auto webserver: webservers) {
+        if (!webserver->isIdle()) {
+            inFlightWork -= webserver->process();
+            if (webserver->isIdle()) {
+                busyCount--;
+                dispatch.markIdle(webserver);
+                recordEvent(EVENT_COMPLETED, webserver->getClassIndex(), webserver->getId());
+            }
+        }
+    }
+}
+
+LB_TEMPLATE
+void LB_CLASS::scaleServers() {
+    ScaleAction action = scaler.decide(requestQueue.size(), totalCapacity, webservers.size());
+
+    if (action == SCALE_UP) {
+        int addedClass = scaler.scaleUpClass();
+        addServer(addedClass);
+        scaler.scaled();
+        if (Events::binary) {
+            recordEvent(EVENT_SCALE_UP, addedClass, webservers.size());
+        } else {
+            printLBType();
+            std::cout << GREEN << "Server added (" << serverClasses[addedClass].name << ")." << RESET << "Total servers: " << webservers.size() << "\n";
+            logEvent("Server added (" + serverClasses[addedClass].name + "). Total servers: " + std::to_string(webservers.size()));
+        }
+    } else if (action == SCALE_DOWN) {
+        int removedClass = removeIdleServer();
+        if (removedClass >= 0) {
+            scaler.scaled();
+            if (Events::binary) {
+                recordEvent(EVENT_SCALE_DOWN, removedClass, webservers.size());
+            } else {
+                printLBType();
+                std::cout << YELLOW << "Server removed (" << serverClasses[removedClass].name << ")." << RESET << "Total servers: " << webservers.size() << "\n";
+                logEvent("Server removed (" + serverClasses[removedClass].name + "). Total servers: " + std::to_string(webservers.size()));
+            }
+        }
+    }
+}
+
+LB_TEMPLATE
+void LB_CLASS::addServer() {
+    addServer(scaler.scaleUpClass());
+}
+
+LB_TEMPLATE
+void LB_CLASS::addServer(int classIndex) {
+    const ServerClass& serverClass = serverClasses[classIndex];
+    WebServer* webserver = new WebServer(nextServerId++, classIndex, serverClass.speed);
+    webserver->setSlot(webservers.size());
+    webservers.push_back(webserver);
+    dispatch.markIdle(webserver);
+    classCounts[classIndex]++;
+    totalCapacity += serverClass.speed;
+    fleetCostPerCycle += serverClass.costPerCycle;
+}
+
+LB_TEMPLATE
+bool LB_CLASS::removeServer() {
+    return removeIdleServer() >= 0;
+}
+
+LB_TEMPLATE
+int LB_CLASS::removeIdleServer() {
+    if (dispatch.idleCount() == 0) {
+        return -1;
+    }
+    for (int classIndex: scaler.scaleDownOrder()) {
+        if (classCounts[classIndex] == 0) {
+            continue;
+        }
+        WebServer* webserver = dispatch.takeIdleOfClass(classIndex);
+        if (webserver == nullptr) {
+            continue;
+        }
+
+        // swap with the last server so the pool stays dense without shifting
+        WebServer* last = webservers.back();
+        webservers[webserver->getSlot()] = last;
+        last->setSlot(webserver->getSlot());
+        webservers.pop_back();
+        delete webserver;
+
+        const ServerClass& serverClass = serverClasses[classIndex];
+        classCounts[classIndex]--;
+        totalCapacity -= serverClass.speed;
+        fleetCostPerCycle -= serverClass.costPerCycle;
+        return classIndex;
+    }
+    return -1;
+}
+
+LB_TEMPLATE
+bool LB_CLASS::isBlockedIP(const std::string& ip) {
+    if (firewall.blocks(ip)) {
+        if (Events::binary) {
+            recordEvent(EVENT_BLOCKED, 0, packIPv4(ip));
+        } else {
+            printLBType();
+            std::cout << RED << "Blocked IP: " << ip << RESET << "\n";
+            logEvent("Blocked IP: " + ip);
+        }
+        return true;
+    }
+    return false;
+}
+
+// not used with switch class. Was used for a single loadbalancer run
+LB_TEMPLATE
+void LB_CLASS::run(int totalCycles) {
+    generateInitialQueue();
+
+    for (int i = 0; i < totalCycles; i++) {
+        currentTime++;
+
+        generateRandomRequests();
+        distributeRequests();
+        scaleServers();
+        totalCost += fleetCostPerCycle;
+        checkInvariants();
+    }
+}
+
+LB_TEMPLATE
+void LB_CLASS::logEvent(const std::string& message) {
+    logFile << "[Time " << currentTime << "] " << message << "\n";
+}
+
+LB_TEMPLATE
+void LB_CLASS::printSummary(int totalCycles, int numServers) {
+    events.record(totalCycles, EVENT_RUN_END, lbType, webservers.size());
+    if (!events.flush()) {
+        std::cerr << RED << "Event log write failed; the binary log is incomplete" << RESET << "\n";
+    }
+
+    std::cout << "\n===== " << typeColor << typeName << " Load Balancer Summary" << RESET << " =====\n";
+    logFile << "\n===== " << typeName << " Load Balancer Summary =====\n";
+
+    std::cout << "Total Processed: " << totalProcessed << "\n";
+    std::cout << "Total Total Cycles: " << totalCycles << "\n";
+    std::cout << "Clock Cycles Between Scaling Servers: " << scaler.getCoolDownPeriod() << "\n";
+    std::cout << "Throughput: " << (static_cast<double>(totalProcessed) / totalCycles * 100) << "%" << "\n";
+    std::cout << "Total Blocked (Firewall): " << totalBlocked << "\n";
+    std::cout << "Task Time Range: " << lowerTaskTime << " to " << upperTaskTime << " Clock Cycles" << "\n";
+    std::cout << "Starting Server Count: " << numServers << "\n";
+    std::cout << "Final Server Count: " << webservers.size() << "\n";
+    for (size_t i = 0; i < serverClasses.size(); ++i) {
+        std::cout << "  " << serverClasses[i].name << " (speed " << serverClasses[i].speed << "): " << classCounts[i] << "\n";
+    }
+    std::cout << "Total Fleet Cost: " << totalCost << "\n";
+    std::cout << "Busy / Idle Servers: " << busyCount << " / " << dispatch.idleCount() << "\n";
+    std::cout << "Outstanding Work: " << (queuedWork + inFlightWork) << " Clock Cycles (" << queuedWork << " queued, " << inFlightWork << " in flight)" << "\n";
+    std::cout << "Ending Request Queue Size: " << requestQueue.size() << "\n";
+
+    logFile << "Total Processed: " << totalProcessed << "\n";
+    logFile << "Total Total Cycles: " << totalCycles << "\n";
+    logFile << "Clock Cycles Between Scaling Servers: " << scaler.getCoolDownPeriod() << "\n";
+    logFile << "Throughput: " << (static_cast<double>(totalProcessed) / totalCycles * 100) << "%" << "\n";
+    logFile << "Total Blocked (Firewall): " << totalBlocked << "\n";
+    logFile << "Task Time Range: " << lowerTaskTime << " to " << upperTaskTime << " Clock cycles" << "\n";
+    logFile << "Starting Server Count: " << numServers << "\n";
+    logFile << "Final Server Count: " << webservers.size() << "\n";
+    for (size_t i = 0; i < serverClasses.size(); ++i) {
+        logFile << "  " << serverClasses[i].name << " (speed " << serverClasses[i].speed << "): " << classCounts[i] << "\n";
+    }
+    logFile << "Total Fleet Cost: " << totalCost << "\n";
+    logFile << "Busy / Idle Servers: " << busyCount << " / " << dispatch.idleCount() << "\n";
+    logFile << "Outstanding Work: " << (queuedWork + inFlightWork) << " Clock Cycles (" << queuedWork << " queued, " << inFlightWork << " in flight)" << "\n";
+    logFile << "Ending Request Queue Size: " << requestQueue.size() << "\n";
+}
+
+LB_TEMPLATE
+void LB_CLASS::addRequest(const Request& req) {
+    upperTaskTime = std::max(upperTaskTime, req.timeRequired);
+    lowerTaskTime = std::min(lowerTaskTime, req.timeRequired);
+    enqueue(req);
+}
+
+LB_TEMPLATE
+void LB_CLASS::runOneCycle() {
+    currentTime++;
+    distributeRequests();
+    scaleServers();
+    totalCost += fleetCostPerCycle;
+    checkInvariants();
+}
+
+LB_TEMPLATE
+void LB_CLASS::printLBType() {
+    std::cout << typeColor << typeName << ": " << RESET;
+}
+
+LB_TEMPLATE
+int LB_CLASS::getTotalProcessed() const {
+    return totalProcessed;
+}
+
+LB_TEMPLATE
+int LB_CLASS::getTotalBlocked() const {
+    return totalBlocked;
+}
+
+LB_TEMPLATE
+int LB_CLASS::getServerCount() const {
+    return webservers.size();
+}
+
+LB_TEMPLATE
+int LB_CLASS::getQueueSize() const {
+    return requestQueue.size();
+}
+
+LB_TEMPLATE
+void LB_CLASS::setEventLog(EventLog* log, int id) {
+    events.attach(log, id);
+}
+
+LB_TEMPLATE
+void LB_CLASS::enqueue(const Request& req) {
+    requestQueue.push(req);
+    queuedWork += req.timeRequired;
+}
+
+LB_TEMPLATE
+void LB_CLASS::checkInvariants() const {
+#ifndef NDEBUG
+    int idle = 0;
+    int busy = 0;
+    double capacity = 0;
+    double cost = 0;
+    double inFlight = 0;
+    std::vector<int> counts(serverClasses.size(), 0);
+    for (size_t i = 0; i < webservers.size(); ++i) {
+        const WebServer* webserver = webservers[i];
+        assert(webserver->getSlot() == (int)i);
+        const ServerClass& serverClass = serverClasses[webserver->getClassIndex()];
+        if (webserver->isIdle()) {
+            idle++;
+            assert(dispatch.isIndexed(webserver));
+        } else {
+            busy++;
+            inFlight += webserver->getRemainingTime();
+        }
+        counts[webserver->getClassIndex()]++;
+        capacity += serverClass.speed;
+        cost += serverClass.costPerCycle;
+    }
+
+    long long queued = 0;
+    for (size_t i = 0; i < requestQueue.size(); ++i) {
+        queued += requestQueue.at(i).timeRequired;
+    }
+
+    assert(idle == dispatch.idleCount() && busy == busyCount);
+    assert(dispatch.indexedCount() == (size_t)dispatch.idleCount());
+    assert(counts == classCounts);
+    assert(queued == queuedWork);
+    assert(std::fabs(inFlight - inFlightWork) < 1e-6 * (1 + inFlight));
+    assert(std::fabs(capacity - totalCapacity) < 1e-6 * (1 + capacity));
+    assert(std::fabs(cost - fleetCostPerCycle) < 1e-6 * (1 + cost));
+#endif
+}
+
+#undef LB_TEMPLATE
+#undef LB_CLASS
+
+#endif
@@ -0,0 +1,438 @@
+#ifndef LOADBALANCERPOLICIES_H
+#define LOADBALANCERPOLICIES_H
+
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cassert>
+#include "Request.h"
+#include "WebServer.h"
+#include "ServerClass.h"
+#include "EventLog.h"
+
+/**
+ * @file LoadBalancerPolicies.h
+ * @brief Default compile-time policies plugged into BasicLoadBalancer.
+ *
+ * Each policy is a plain class with non-virtual member functions defined in
+ * this header, so BasicLoadBalancer's per-cycle loop inlines them completely.
+ * Any class with the same members can be substituted as a template argument.
+ */
+
+/**
+ * @brief Dispatch policy: capacity-aware placement through an indexed idle pool.
+ *
+ * Idle servers are kept in ordered maps grouped by class affinity and sorted
+ * by speed. Servers whose affinity matches the request's job type (or accepts
+ * any job) are preferred; among those, requests longer than 50 cycles go to
+ * the fastest idle server and shorter ones to the slowest, keeping fast
+ * servers free for long work. All operations are O(log n).
+ */
+class CapacityDispatch {
+private:
+    /**
+     * @brief Ordering key for idle servers: slowest first, ties broken by class then id.
+     */
+    struct IdleKey {
+        double speed;
+        int classIndex;
+        int serverId;
+
+        bool operator<(const IdleKey& other) const {
+            if (speed != other.speed) {
+                return speed < other.speed;
+            }
+            if (classIndex != other.classIndex) {
+                return classIndex < other.classIndex;
+            }
+            return serverId < other.serverId;
+        }
+    };
+    typedef std::map<IdleKey, WebServer*> IdleIndex;
+
+    std::vector<char> classAffinity;        ///< Affinity of each server class
+    std::vector<double> classSpeed;         ///< Speed of each server class
+    std::map<char, IdleIndex> idleServers;  ///< Idle servers grouped by class affinity, ordered by speed
+    int idle;                               ///< Total number of indexed servers
+    int longJobThreshold;                   ///< Requests needing more time than this go to the fastest idle server
+
+    static IdleKey keyFor(const WebServer* server) {
+        IdleKey key;
+        key.speed = server->getSpeed();
+        key.classIndex = server->getClassIndex();
+        key.serverId = server->getId();
+        return key;
+    }
+
+public:
+    CapacityDispatch() {
+        idle = 0;
+        longJobThreshold = 50; // midpoint of the 1-100 request time range
+    }
+
+    /**
+     * @brief Records the fleet's server classes; called once before any server is added.
+     */
+    void configure(const std::vector<ServerClass>& fleet) {
+        for (const ServerClass& serverClass: fleet) {
+            classAffinity.push_back(serverClass.affinity);
+            classSpeed.push_back(serverClass.speed);
+        }
+    }
+
+    /**
+     * @brief Records a server as idle.
+     */
+    void markIdle(WebServer* server) {
+        idleServers[classAffinity[server->getClassIndex()]][keyFor(server)] = server;
+        idle++;
+    }
+
+    /**
+     * @brief Removes and returns the best idle server for a request, or nullptr if none is idle.
+     */
+    WebServer* takeIdle(const Request& req) {
+        bool longJob = req.timeRequired > longJobThreshold;
+        IdleIndex* bestPool = nullptr;
+        IdleIndex::iterator best;
+        bool bestPreferred = false;
+
+        // at most one candidate per affinity group: the fastest for long jobs, the slowest otherwise
+        for (auto& group: idleServers) {
+            IdleIndex& pool = group.second;
+            if (pool.empty()) {
+                continue;
+            }
+            IdleIndex::iterator candidate = longJob ? std::prev(pool.end()) : pool.begin();
+            bool preferred = group.first == req.jobType || group.first == 'A';
+
+            bool better;
+            if (bestPool == nullptr || preferred != bestPreferred) {
+                better = bestPool == nullptr || preferred;
+            } else if (longJob) {
+                better = best->first < candidate->first;
+            } else {
+                better = candidate->first < best->first;
+            }
+            if (better) {
+                bestPool = &pool;
+                best = candidate;
+                bestPreferred = preferred;
+            }
+        }
+
+        if (bestPool == nullptr) {
+            return nullptr;
+        }
+        WebServer* server = best->second;
+        bestPool->erase(best);
+        idle--;
+        return server;
+    }
+
+    /**
+     * @brief Removes and returns an idle server of the given class, or nullptr if none is idle.
+     */
+    WebServer* takeIdleOfClass(int classIndex) {
+        IdleIndex& pool = idleServers[classAffinity[classIndex]];
+
+        // idle servers of one class are contiguous in the index
+        IdleKey first;
+        first.speed = classSpeed[classIndex];
+        first.classIndex = classIndex;
+        first.serverId = std::numeric_limits<int>::min();
+        IdleIndex::iterator it = pool.lower_bound(first);
+        if (it == pool.end() || it->first.classIndex != classIndex) {
+            return nullptr;
+        }
+        WebServer* server = it->second;
+        pool.erase(it);
+        idle--;
+        return server;
+    }
+
+    /**
+     * @brief Returns the number of idle servers.
+     */
+    int idleCount() const {
+        return idle;
+    }
+
+    /**
+     * @brief Checks that a server is in the idle index (used by debug invariant checks).
+     */
+    bool isIndexed(const WebServer* server) const {
+        std::map<char, IdleIndex>::const_iterator group = idleServers.find(classAffinity[server->getClassIndex()]);
+        if (group == idleServers.end()) {
+            return false;
+        }
+        IdleIndex::const_iterator it = group->second.find(keyFor(server));
+        return it != group->second.end() && it->second == server;
+    }
+
+    /**
+     * @brief Counts the entries in the idle index (used by debug invariant checks).
+     */
+    size_t indexedCount() const {
+        size_t indexed = 0;
+        for (const auto& group: idleServers) {
+            indexed += group.second.size();
+        }
+        return indexed;
+    }
+};
+
+/**
+ * @brief Result of a scaling decision.
+ */
+enum ScaleAction {
+    SCALE_NONE,     ///< Leave the fleet as it is
+    SCALE_UP,       ///< Add a server of scaleUpClass()
+    SCALE_DOWN      ///< Remove an idle server, trying classes in scaleDownOrder()
+};
+
+/**
+ * @brief Scaling policy: capacity thresholds with a cooldown and cost-based class choice.
+ *
+ * Adds a server when the queue exceeds 80 requests per unit of capacity and
+ * removes one when it drops below 50, waiting a cooldown period after every
+ * change. Scale-up uses the cheapest class per unit of work that suits the
+ * load balancer's job type; scale-down removes the most expensive classes first.
+ */
+class CostAwareScaler {
+private:
+    int coolDownCounter;            ///< Cycles remaining before next scaling operation
+    int coolDownPeriod;             ///< Minimum cycles between scaling operations
+    int minThreshold;               ///< Queued requests per unit of capacity below which servers are removed
+    int maxThreshold;               ///< Queued requests per unit of capacity above which servers are added
+    int upClass;                    ///< Class added when scaling up
+    std::vector<int> downOrder;     ///< Class indices from most to least expensive per unit of work
+
+public:
+    CostAwareScaler() {
+        coolDownCounter = 0;
+        coolDownPeriod = 0;
+        minThreshold = 50;
+        maxThreshold = 80;
+        upClass = 0;
+    }
+
+    /**
+     * @brief Chooses scale-up and scale-down classes for a fleet.
+     *
+     * @param fleet Server classes available to the load balancer
+     * @param lbType Job type of the load balancer ('S' or 'P')
+     * @param coolDown Minimum cycles between scaling operations
+     */
+    void configure(const std::vector<ServerClass>& fleet, char lbType, int coolDown) {
+        coolDownPeriod = coolDown;
+
+        // scale up with the cheapest class per unit of work that suits this load balancer's jobs
+        upClass = -1;
+        for (int i = 0; i < (int)fleet.size(); ++i) {
+            if (fleet[i].affinity != lbType && fleet[i].affinity != 'A') {
+                continue;
+            }
+            if (upClass < 0 || fleet[i].costPerUnitWork() < fleet[upClass].costPerUnitWork()) {
+                upClass = i;
+            }
+        }
+        if (upClass < 0) {
+            upClass = 0;
+            for (int i = 1; i < (int)fleet.size(); ++i) {
+                if (fleet[i].costPerUnitWork() < fleet[upClass].costPerUnitWork()) {
+                    upClass = i;
+                }
+            }
+        }
+
+        // scale down the most expensive classes first
+        downOrder.clear();
+        for (int i = 0; i < (int)fleet.size(); ++i) {
+            downOrder.push_back(i);
+        }
+        std::stable_sort(downOrder.begin(), downOrder.end(), [&fleet](int a, int b) {
+            return fleet[a].costPerUnitWork() > fleet[b].costPerUnitWork();
+        });
+    }
+
+    /**
+     * @brief Decides whether to scale this cycle; counts down the cooldown.
+     *
+     * @param queueSize Number of queued requests
+     * @param totalCapacity Sum of server speeds
+     * @param serverCount Number of servers
+     * @return ScaleAction What the load balancer should do
+     */
+    ScaleAction decide(int queueSize, double totalCapacity, int serverCount) {
+        if (coolDownCounter > 0) {
+            coolDownCounter--;
+            return SCALE_NONE;
+        }
+        if (queueSize > maxThreshold * totalCapacity) {
+            return SCALE_UP;
+        }
+        if (queueSize < minThreshold * totalCapacity && serverCount > 1) {
+            return SCALE_DOWN;
+        }
+        return SCALE_NONE;
+    }
+
+    /**
+     * @brief Starts the cooldown after a server was added or removed.
+     */
+    void scaled() {
+        coolDownCounter = coolDownPeriod;
+    }
+
+    /**
+     * @brief Returns the class to add when scaling up.
+     */
+    int scaleUpClass() const {
+        return upClass;
+    }
+
+    /**
+     * @brief Returns class indices in the order idle servers should be removed.
+     */
+    const std::vector<int>& scaleDownOrder() const {
+        return downOrder;
+    }
+
+    /**
+     * @brief Returns the minimum number of cycles between scaling operations.
+     */
+    int getCoolDownPeriod() const {
+        return coolDownPeriod;
+    }
+};
+
+/**
+ * @brief Firewall policy: blocks source addresses in the 10.0.0.0/8 private range.
+ */
+class PrefixFirewall {
+public:
+    /**
+     * @brief Checks whether requests from an address must be dropped.
+     */
+    bool blocks(const std::string& ip) const {
+        return ip.compare(0, 3, "10.") == 0;
+    }
+};
+
+/**
+ * @brief Queue policy: first-in first-out request queue.
+ */
+class FifoQueue {
+private:
+    std::deque<Request> requests;   ///< Pending requests, oldest first
+
+public:
+    void push(const Request& req) {
+        requests.push_back(req);
+    }
+
+    const Request& front() const {
+        return requests.front();
+    }
+
+    void pop() {
+        requests.pop_front();
+    }
+
+    bool empty() const {
+        return requests.empty();
+    }
+
+    size_t size() const {
+        return requests.size();
+    }
+
+    /**
+     * @brief Returns the i-th pending request, oldest first (used by debug invariant checks).
+     */
+    const Request& at(size_t i) const {
+        return requests[i];
+    }
+};
+
+/**
+ * @brief Event policy: records nothing.
+ *
+ * Queue start, scaling and blocked-request events are echoed to the console
+ * and written to the load balancer's text log; per-request events are
+ * dropped. Every call compiles away.
+ */
+class NullEventSink {
+public:
+    static const bool binary = false;   ///< Events are printed and written to the text log instead
+
+    /**
+     * @brief Ignored: this sink has no log to write to.
+     */
+    void attach(EventLog*, int) {}
+
+    /**
+     * @brief Discards an event.
+     */
+    void record(uint64_t, uint8_t, uint8_t, uint32_t) {}
+
+    /**
+     * @brief Nothing to flush; always succeeds.
+     */
+    bool flush() { return true; }
+};
+
+/**
+ * @brief Event policy: fixed-size records in a binary EventLog.
+ *
+ * Replaces the text log lines and per-event console output for queue start,
+ * scaling and blocked requests, and additionally records every dispatch and
+ * completion. Several load
+ * balancers may share one log, told apart by their identifier.
+ */
+class BinaryEventSink {
+private:
+    EventLog* log;      ///< Shared event log, set by attach()
+    int lbId;           ///< Identifier written to this load balancer's records
+
+public:
+    static const bool binary = true;    ///< Events replace the text log lines and console echo
+
+    BinaryEventSink() {
+        log = nullptr;
+        lbId = 0;
+    }
+
+    /**
+     * @brief Sets the log to write to; must be called before the first event.
+     */
+    void attach(EventLog* eventLog, int id) {
+        log = eventLog;
+        lbId = id;
+    }
+
+    /**
+     * @brief Appends one record to the log.
+     */
+    void record(uint64_t cycle, uint8_t type, uint8_t detail, uint32_t payload) {
+        assert(log != nullptr && "setEventLog() must be called before the first event");
+        log->record(cycle, lbId, type, detail, payload);
+    }
+
+    /**
+     * @brief Writes buffered records to the file.
+     *
+     * @return bool False if any write to the log has failed
+     */
+    bool flush() {
+        assert(log != nullptr && "setEventLog() must be called before the first event");
+        return log->flush();
+    }
+};
+
+#endif
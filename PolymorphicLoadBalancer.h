@@ -0,0 +1,15 @@
+#ifndef POLYMORPHICLOADBALANCER_H
+#define POLYMORPHICLOADBALANCER_H
+
+#include "LoadBalancer.h"
+#include "PolymorphicPolicies.h"
+
+/**
+ * @brief LoadBalancer built from runtime-polymorphic policies.
+ *
+ * Behaves exactly like LoadBalancer but every policy call goes through a
+ * virtual interface. Used as the baseline in lbbench.
+ */
+typedef BasicLoadBalancer<VirtualDispatch, VirtualScaler, VirtualFirewall, VirtualQueue> PolymorphicLoadBalancer;
+
+#endif
@@ -0,0 +1,77 @@
+/**
+ * @file PolymorphicPolicies.cpp
+ * @brief Virtual adapters around the default load balancer policies.
+ *
+ * The adapters live in their own translation unit so that code calling through
+ * the interfaces cannot devirtualize the calls.
+ */
+
+#include "PolymorphicPolicies.h"
+
+namespace {
+
+class CapacityDispatchAdapter : public DispatchInterface {
+private:
+    CapacityDispatch policy;
+
+public:
+    void configure(const std::vector<ServerClass>& fleet) override { policy.configure(fleet); }
+    void markIdle(WebServer* server) override { policy.markIdle(server); }
+    WebServer* takeIdle(const Request& req) override { return policy.takeIdle(req); }
+    WebServer* takeIdleOfClass(int classIndex) override { return policy.takeIdleOfClass(classIndex); }
+    int idleCount() const override { return policy.idleCount(); }
+    bool isIndexed(const WebServer* server) const override { return policy.isIndexed(server); }
+    size_t indexedCount() const override { return policy.indexedCount(); }
+};
+
+class CostAwareScalerAdapter : public ScalerInterface {
+private:
+    CostAwareScaler policy;
+
+public:
+    void configure(const std::vector<ServerClass>& fleet, char lbType, int coolDown) override { policy.configure(fleet, lbType, coolDown); }
+    ScaleAction decide(int queueSize, double totalCapacity, int serverCount) override { return policy.decide(queueSize, totalCapacity, serverCount); }
+    void scaled() override { policy.scaled(); }
+    int scaleUpClass() const override { return policy.scaleUpClass(); }
+    const std::vector<int>& scaleDownOrder() const override { return policy.scaleDownOrder(); }
+    int getCoolDownPeriod() const override { return policy.getCoolDownPeriod(); }
+};
+
+class PrefixFirewallAdapter : public FirewallInterface {
+private:
+    PrefixFirewall policy;
+
+public:
+    bool blocks(const std::string& ip) const override { return policy.blocks(ip); }
+};
+
+class FifoQueueAdapter : public QueueInterface {
+private:
+    FifoQueue policy;
+
+public:
+    void push(const Request& req) override { policy.push(req); }
+    const Request& front() const override { return policy.front(); }
+    void pop() override { policy.pop(); }
+    bool empty() const override { return policy.empty(); }
+    size_t size() const override { return policy.size(); }
+    const Request& at(size_t i) const override { return policy.at(i); }
+};
+
+}
+
+DispatchInterface* makeDispatchImplementation() {
+    return new CapacityDispatchAdapter();
+}
+
+ScalerInterface* makeScalerImplementation() {
+    return new CostAwareScalerAdapter();
+}
+
+FirewallInterface* makeFirewallImplementation() {
+    return new PrefixFirewallAdapter();
+}
+
+QueueInterface* makeQueueImplementation() {
+    return new FifoQueueAdapter();
+}
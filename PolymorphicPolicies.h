@@ -0,0 +1,154 @@
+#ifndef POLYMORPHICPOLICIES_H
+#define POLYMORPHICPOLICIES_H
+
+#include <memory>
+#include "LoadBalancerPolicies.h"
+
+/**
+ * @file PolymorphicPolicies.h
+ * @brief Runtime-polymorphic versions of the default load balancer policies.
+ *
+ * Each Virtual* policy forwards every call through a virtual interface to an
+ * implementation created in PolymorphicPolicies.cpp, where the compiler
+ * cannot see the concrete type. PolymorphicLoadBalancer therefore runs the
+ * same behavior as LoadBalancer but pays for an indirect call per policy
+ * operation, which is what lbbench measures.
+ */
+
+/**
+ * @brief Virtual interface matching CapacityDispatch.
+ */
+class DispatchInterface {
+public:
+    virtual ~DispatchInterface() {}
+    virtual void configure(const std::vector<ServerClass>& fleet) = 0;
+    virtual void markIdle(WebServer* server) = 0;
+    virtual WebServer* takeIdle(const Request& req) = 0;
+    virtual WebServer* takeIdleOfClass(int classIndex) = 0;
+    virtual int idleCount() const = 0;
+    virtual bool isIndexed(const WebServer* server) const = 0;
+    virtual size_t indexedCount() const = 0;
+};
+
+/**
+ * @brief Virtual interface matching CostAwareScaler.
+ */
+class ScalerInterface {
+public:
+    virtual ~ScalerInterface() {}
+    virtual void configure(const std::vector<ServerClass>& fleet, char lbType, int coolDown) = 0;
+    virtual ScaleAction decide(int queueSize, double totalCapacity, int serverCount) = 0;
+    virtual void scaled() = 0;
+    virtual int scaleUpClass() const = 0;
+    virtual const std::vector<int>& scaleDownOrder() const = 0;
+    virtual int getCoolDownPeriod() const = 0;
+};
+
+/**
+ * @brief Virtual interface matching PrefixFirewall.
+ */
+class FirewallInterface {
+public:
+    virtual ~FirewallInterface() {}
+    virtual bool blocks(const std::string& ip) const = 0;
+};
+
+/**
+ * @brief Virtual interface matching FifoQueue.
+ */
+class QueueInterface {
+public:
+    virtual ~QueueInterface() {}
+    virtual void push(const Request& req) = 0;
+    virtual const Request& front() const = 0;
+    virtual void pop() = 0;
+    virtual bool empty() const = 0;
+    virtual size_t size() const = 0;
+    virtual const Request& at(size_t i) const = 0;
+};
+
+/**
+ * @brief Creates the default dispatch implementation behind its virtual interface.
+ */
+DispatchInterface* makeDispatchImplementation();
+
+/**
+ * @brief Creates the default scaler implementation behind its virtual interface.
+ */
+ScalerInterface* makeScalerImplementation();
+
+/**
+ * @brief Creates the default firewall implementation behind its virtual interface.
+ */
+FirewallInterface* makeFirewallImplementation();
+
+/**
+ * @brief Creates the default queue implementation behind its virtual interface.
+ */
+QueueInterface* makeQueueImplementation();
+
+/**
+ * @brief Dispatch policy that forwards to a DispatchInterface.
+ */
+class VirtualDispatch {
+private:
+    std::unique_ptr<DispatchInterface> impl;
+
+public:
+    VirtualDispatch() : impl(makeDispatchImplementation()) {}
+    void configure(const std::vector<ServerClass>& fleet) { impl->configure(fleet); }
+    void markIdle(WebServer* server) { impl->markIdle(server); }
+    WebServer* takeIdle(const Request& req) { return impl->takeIdle(req); }
+    WebServer* takeIdleOfClass(int classIndex) { return impl->takeIdleOfClass(classIndex); }
+    int idleCount() const { return impl->idleCount(); }
+    bool isIndexed(const WebServer* server) const { return impl->isIndexed(server); }
+    size_t indexedCount() const { return impl->indexedCount(); }
+};
+
+/**
+ * @brief Scaling policy that forwards to a ScalerInterface.
+ */
+class VirtualScaler {
+private:
+    std::unique_ptr<ScalerInterface> impl;
+
+public:
+    VirtualScaler() : impl(makeScalerImplementation()) {}
+    void configure(const std::vector<ServerClass>& fleet, char lbType, int coolDown) { impl->configure(fleet, lbType, coolDown); }
+    ScaleAction decide(int queueSize, double totalCapacity, int serverCount) { return impl->decide(queueSize, totalCapacity, serverCount); }
+    void scaled() { impl->scaled(); }
+    int scaleUpClass() const { return impl->scaleUpClass(); }
+    const std::vector<int>& scaleDownOrder() const { return impl->scaleDownOrder(); }
+    int getCoolDownPeriod() const { return impl->getCoolDownPeriod(); }
+};
+
+/**
+ * @brief Firewall policy that forwards to a FirewallInterface.
+ */
+class VirtualFirewall {
+private:
+    std::unique_ptr<FirewallInterface> impl;
+
+public:
+    VirtualFirewall() : impl(makeFirewallImplementation()) {}
+    bool blocks(const std::string& ip) const { return impl->blocks(ip); }
+};
+
+/**
+ * @brief Queue policy that forwards to a QueueInterface.
+ */
+class VirtualQueue {
+private:
+    std::unique_ptr<QueueInterface> impl;
+
+public:
+    VirtualQueue() : impl(makeQueueImplementation()) {}
+    void push(const Request& req) { impl->push(req); }
+    const Request& front() const { return impl->front(); }
+    void pop() { impl->pop(); }
+    bool empty() const { return impl->empty(); }
+    size_t size() const { return impl->size(); }
+    const Request& at(size_t i) const { return impl->at(i); }
+};
+
+#endif
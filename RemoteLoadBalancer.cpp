@@ -0,0 +1,75 @@
+/**
+ * @file RemoteLoadBalancer.cpp
+ * @brief Implementation of the switch-side proxy for a remote load balancer node.
+ *
+ * Encodes routed requests into per-window batches and tracks acknowledgements
+ * for the conservative window protocol described in Transport.h.
+ */
+
+#include "RemoteLoadBalancer.h"
+#include <stdexcept>
+
+RemoteLoadBalancer::RemoteLoadBalancer(const std::string& endpoint, int timeoutMs)
+    : connection(Connection::connectTo(endpoint, timeoutMs)) {
+    pendingCount = 0;
+    windowStart = 0;
+    windowsInFlight = 0;
+}
+
+void RemoteLoadBalancer::addRequest(const Request& req, uint64_t cycle) {
+    pendingRequests.put16(cycle - windowStart);
+    pendingRequests.put32(packIPv4(req.ipIn));
+    pendingRequests.put32(packIPv4(req.ipOut));
+    pendingRequests.put16(req.timeRequired);
+    pendingRequests.put8(req.jobType);
+    pendingCount++;
+}
+
+void RemoteLoadBalancer::sendWindow(uint64_t start, uint32_t length) {
+    if (start != windowStart || length == 0 || length > 65535) {
+        throw std::runtime_error("invalid lookahead window");
+    }
+    WireWriter frame;
+    frame.put64(start);
+    frame.put32(length);
+    frame.put32(pendingCount);
+    frame.putBytes(pendingRequests.data());
+    connection->sendFrame(MSG_WINDOW, frame.data());
+
+    pendingRequests.clear();
+    pendingCount = 0;
+    windowStart = start + length;
+    windowsInFlight++;
+}
+
+void RemoteLoadBalancer::waitForWindow() {
+    if (connection->recvFrame(reply) != MSG_WINDOW_DONE) {
+        throw std::runtime_error("expected window acknowledgement from node");
+    }
+    windowsInFlight--;
+}
+
+int RemoteLoadBalancer::getWindowsInFlight() const {
+    return windowsInFlight;
+}
+
+RemoteSummary RemoteLoadBalancer::finish(uint64_t totalCycles) {
+    while (windowsInFlight > 0) {
+        waitForWindow();
+    }
+
+    WireWriter frame;
+    frame.put64(totalCycles);
+    connection->sendFrame(MSG_FINISH, frame.data());
+
+    if (connection->recvFrame(reply) != MSG_SUMMARY) {
+        throw std::runtime_error("expected summary from node");
+    }
+    WireReader in(reply);
+    RemoteSummary summary;
+    summary.processed = in.get64();
+    summary.blocked = in.get64();
+    summary.finalServers = in.get32();
+    summary.queueSize = in.get64();
+    return summary;
+}
@@ -0,0 +1,85 @@
+#ifndef REMOTELOADBALANCER_H
+#define REMOTELOADBALANCER_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "Request.h"
+#include "Transport.h"
+
+/**
+ * @brief Final statistics reported by a load balancer node.
+ */
+struct RemoteSummary {
+    uint64_t processed;     ///< Requests assigned to servers
+    uint64_t blocked;       ///< Requests blocked by the firewall
+    uint32_t finalServers;  ///< Server count at the end of the run
+    uint64_t queueSize;     ///< Requests still queued at the end of the run
+};
+
+/**
+ * @brief Switch-side proxy for a LoadBalancer running in another process.
+ *
+ * Requests routed to the proxy are buffered for the current lookahead window
+ * and sent to the node as one compact batch when the window is closed. The
+ * node acknowledges each window once it has simulated it, which bounds how far
+ * the switch can run ahead.
+ */
+class RemoteLoadBalancer {
+private:
+    std::unique_ptr<Connection> connection;   ///< Socket to the LBNode
+    WireWriter pendingRequests;               ///< Encoded requests for the open window
+    uint32_t pendingCount;                    ///< Number of requests in pendingRequests
+    uint64_t windowStart;                     ///< First cycle of the open window
+    int windowsInFlight;                      ///< Windows sent but not yet acknowledged
+    std::vector<uint8_t> reply;               ///< Receive buffer for node replies
+
+public:
+    /**
+     * @brief Connects to a node, waiting up to timeoutMs for it to start listening.
+     *
+     * @param endpoint "unix:/path" or "tcp:host:port"
+     * @param timeoutMs How long to retry while the node is not yet listening
+     */
+    RemoteLoadBalancer(const std::string& endpoint, int timeoutMs);
+
+    /**
+     * @brief Buffers a request arriving at the given cycle of the open window.
+     *
+     * Requests must be added in non-decreasing cycle order.
+     *
+     * @param req The request to forward
+     * @param cycle Simulation cycle the request arrives in
+     */
+    void addRequest(const Request& req, uint64_t cycle);
+
+    /**
+     * @brief Sends the open window's requests and lets the node simulate it.
+     *
+     * @param start First cycle of the window (must follow the previous window)
+     * @param length Number of cycles in the window (at most 65535)
+     */
+    void sendWindow(uint64_t start, uint32_t length);
+
+    /**
+     * @brief Blocks until the node acknowledges the oldest unacknowledged window.
+     */
+    void waitForWindow();
+
+    /**
+     * @brief Returns the number of windows sent but not yet acknowledged.
+     */
+    int getWindowsInFlight() const;
+
+    /**
+     * @brief Tells the node the run is over and collects its statistics.
+     *
+     * The node prints its own summary before replying.
+     *
+     * @param totalCycles Total number of simulated cycles
+     * @return RemoteSummary The node's final statistics
+     */
+    RemoteSummary finish(uint64_t totalCycles);
+};
+
+#endif
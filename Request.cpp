@@ -9,6 +9,7 @@
 #include "Request.h"
 #include <cstdlib>
 #include <ctime>
+#include <cstdio>
 
 Request::Request() {
     ipIn = generateRandomIP();
@@ -17,6 +18,13 @@ Request::Request() {
     jobType = generateRandomJobType();
 }
 
+Request::Request(const std::string& sourceIP, const std::string& destinationIP, int time, char type) {
+    ipIn = sourceIP;
+    ipOut = destinationIP;
+    timeRequired = time;
+    jobType = type;
+}
+
 std::string Request::generateRandomIP() {
     return std::to_string(std::rand() % 256) + "." +
         std::to_string(std::rand() % 256) + "." +
@@ -35,4 +43,19 @@ char Request::generateRandomJobType() {
     } else {
         return 'S';
     }
-}
\ No newline at end of file
+}
+
+uint32_t packIPv4(const std::string& ip) {
+    unsigned int a, b, c, d;
+    if (std::sscanf(ip.c_str(), "%u.%u.%u.%u", &a, &b, &c, &d) != 4 || a > 255 || b > 255 || c > 255 || d > 255) {
+        return 0;
+    }
+    return (a << 24) | (b << 16) | (c << 8) | d;
+}
+
+std::string unpackIPv4(uint32_t ip) {
+    return std::to_string(ip >> 24) + "." +
+        std::to_string((ip >> 16) & 0xFF) + "." +
+        std::to_string((ip >> 8) & 0xFF) + "." +
+        std::to_string(ip & 0xFF);
+}
@@ -2,6 +2,7 @@
 #define REQUEST_H
 
 #include <string>
+#include <cstdint>
 
 /**
  * @brief Represents a network request in the load balancing simulation.
@@ -23,6 +24,19 @@ struct Request {
      * IP addresses, processing time, and job type are all determined randomly.
      */
     Request();
+
+    /**
+     * @brief Constructs a Request with the given properties.
+     *
+     * Used when a request is rebuilt from its wire encoding, so no random
+     * values are generated.
+     *
+     * @param sourceIP Source IP address
+     * @param destinationIP Destination IP address
+     * @param time Processing time in clock cycles
+     * @param type Job classification: 'S' or 'P'
+     */
+    Request(const std::string& sourceIP, const std::string& destinationIP, int time, char type);
     
     /**
      * @brief Generates a random IPv4 address.
@@ -48,4 +62,22 @@ struct Request {
      */
     char generateRandomJobType();
 };
+
+/**
+ * @brief Packs a dotted decimal IPv4 address into a 32-bit integer.
+ *
+ * The first octet ends up in the most significant byte, so "10.0.0.1" becomes 0x0A000001.
+ *
+ * @param ip Address in dotted decimal notation
+ * @return uint32_t The packed address (0 for malformed input)
+ */
+uint32_t packIPv4(const std::string& ip);
+
+/**
+ * @brief Converts a packed IPv4 address back to dotted decimal notation.
+ *
+ * @param ip Address packed by packIPv4()
+ * @return std::string The address in dotted decimal notation
+ */
+std::string unpackIPv4(uint32_t ip);
 #endif
\ No newline at end of file
@@ -0,0 +1,64 @@
+/**
+ * @file ServerClass.cpp
+ * @brief Implementation of the ServerClass fleet description.
+ *
+ * Provides the cost model used for scaling decisions and parsing of fleet
+ * specifications passed on the command line.
+ */
+
+#include "ServerClass.h"
+#include <sstream>
+#include <stdexcept>
+#include <cstdlib>
+
+ServerClass::ServerClass() {
+    name = "standard";
+    speed = 1.0;
+    costPerCycle = 1.0;
+    affinity = 'A';
+    initialCount = 0;
+}
+
+ServerClass::ServerClass(const std::string& className, double classSpeed, double classCost, char classAffinity, int count) {
+    name = className;
+    speed = classSpeed;
+    costPerCycle = classCost;
+    affinity = classAffinity;
+    initialCount = count;
+}
+
+double ServerClass::costPerUnitWork() const {
+    return costPerCycle / speed;
+}
+
+std::vector<ServerClass> parseFleetSpec(const std::string& spec) {
+    std::vector<ServerClass> fleet;
+    std::stringstream entries(spec);
+    std::string entry;
+
+    while (std::getline(entries, entry, ',')) {
+        std::vector<std::string> fields;
+        std::stringstream parts(entry);
+        std::string field;
+        while (std::getline(parts, field, ':')) {
+            fields.push_back(field);
+        }
+        if (fields.size() != 5 || fields[0].empty() || fields[3].size() != 1) {
+            throw std::invalid_argument("bad fleet entry '" + entry + "' (expected name:speed:cost:affinity:count)");
+        }
+
+        double speed = std::atof(fields[1].c_str());
+        double cost = std::atof(fields[2].c_str());
+        char affinity = fields[3][0];
+        int count = std::atoi(fields[4].c_str());
+        if (speed <= 0 || cost < 0 || count < 0 || (affinity != 'S' && affinity != 'P' && affinity != 'A')) {
+            throw std::invalid_argument("bad fleet entry '" + entry + "'");
+        }
+        fleet.push_back(ServerClass(fields[0], speed, cost, affinity, count));
+    }
+
+    if (fleet.empty()) {
+        throw std::invalid_argument("empty fleet spec");
+    }
+    return fleet;
+}
@@ -0,0 +1,61 @@
+#ifndef SERVERCLASS_H
+#define SERVERCLASS_H
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Describes one class of web server in a heterogeneous fleet.
+ *
+ * A server class captures the hardware profile shared by a group of servers:
+ * how quickly it works through a request, what it costs to keep running, and
+ * which kind of job it is best suited for. Each LoadBalancer is configured with
+ * its own list of classes and uses them for placement and scaling decisions.
+ */
+struct ServerClass {
+    std::string name;       ///< Human readable class name (e.g. "standard", "fast")
+    double speed;           ///< Units of request time processed per clock cycle
+    double costPerCycle;    ///< Cost charged for every cycle a server of this class is running
+    char affinity;          ///< Preferred job type: 'S' for streaming, 'P' for processing, 'A' for any
+    int initialCount;       ///< Number of servers of this class created at startup
+
+    /**
+     * @brief Constructs the default "standard" class (speed 1, cost 1, no affinity, no servers).
+     */
+    ServerClass();
+
+    /**
+     * @brief Constructs a server class with the given profile.
+     *
+     * @param className Human readable class name
+     * @param classSpeed Units of request time processed per clock cycle (must be > 0)
+     * @param classCost Cost charged per running cycle
+     * @param classAffinity Preferred job type: 'S', 'P', or 'A' for any
+     * @param count Number of servers of this class created at startup
+     */
+    ServerClass(const std::string& className, double classSpeed, double classCost, char classAffinity, int count);
+
+    /**
+     * @brief Cost of one unit of request time on this class.
+     *
+     * Used by scaling to pick the cheapest class to add and the most expensive
+     * class to remove.
+     *
+     * @return double costPerCycle divided by speed
+     */
+    double costPerUnitWork() const;
+};
+
+/**
+ * @brief Parses a fleet description from the command line.
+ *
+ * The spec is a comma separated list of classes, each written as
+ * name:speed:cost:affinity:count, for example "small:1:1:A:8,fast:2.5:4:P:2".
+ *
+ * @param spec The fleet description string
+ * @return std::vector<ServerClass> One entry per class in the spec
+ * @throws std::invalid_argument if an entry is malformed
+ */
+std::vector<ServerClass> parseFleetSpec(const std::string& spec);
+
+#endif
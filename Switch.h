@@ -1,6 +1,7 @@
 #ifndef SWITCH_H
 #define SWITCH_H
 
+#include <cstdlib>
 #include "LoadBalancer.h"
 #include "Request.h"
 
@@ -12,20 +13,28 @@
  * It generates incoming requests, classifies them by job type, and routes them
  * to the appropriate load balancer. The Switch also coordinates the simulation
  * execution across both load balancers.
+ *
+ * @tparam LB Load balancer type (LoadBalancer or BinaryLogLoadBalancer)
  */
+template <class LB>
 class Switch {
     private:
-        LoadBalancer* streamingLB;    ///< Load balancer dedicated to streaming requests ('S' jobs)
-        LoadBalancer* processingLB;   ///< Load balancer dedicated to processing requests ('P' jobs)
+        LB* streamingLB;          ///< Load balancer dedicated to streaming requests ('S' jobs)
+        LB* processingLB;         ///< Load balancer dedicated to processing requests ('P' jobs)
+        int streamingServers;     ///< Streaming server count before the run, for the summary
+        int processingServers;    ///< Processing server count before the run, for the summary
 
     public:
         /**
          * @brief Constructs a new Switch with two load balancer instances.
+         *
+         * The load balancers' current server counts are reported as the starting
+         * counts in their summaries, so the switch must be constructed before the run.
          * 
          * @param streamLB Pointer to the load balancer handling streaming requests
          * @param processLB Pointer to the load balancer handling processing requests
          */
-        Switch(LoadBalancer* streamLB, LoadBalancer* processLB);
+        Switch(LB* streamLB, LB* processLB);
         
         /**
          * @brief Routes a request to the appropriate load balancer based on job type.
@@ -50,7 +59,42 @@ class Switch {
          * 
          * @param totalCycles Number of clock cycles to run the simulation
          */
-        void run(int totalCycles, int numServers);
+        void run(int totalCycles);
 };
 
+template <class LB>
+Switch<LB>::Switch(LB* streamLB, LB* processLB) {
+    streamingLB = streamLB;
+    processingLB = processLB;
+    streamingServers = streamLB->getServerCount();
+    processingServers = processLB->getServerCount();
+}
+
+template <class LB>
+void Switch<LB>::routeRequest(const Request& req) {
+    if (req.jobType == 'S') {
+        streamingLB->addRequest(req);
+    }
+    else if (req.jobType == 'P') {
+        processingLB->addRequest(req);
+    }
+}
+
+template <class LB>
+void Switch<LB>::run(int totalCycles) {
+    for (int i = 0; i < totalCycles; i++) {
+        if (rand() % 100 < 40) { // 40% chance of new request
+            Request r;
+            routeRequest(r);
+        }
+        streamingLB->runOneCycle();
+        processingLB->runOneCycle();
+    }
+    streamingLB->printSummary(totalCycles, streamingServers);
+    processingLB->printSummary(totalCycles, processingServers);
+}
+
+extern template class Switch<LoadBalancer>;
+extern template class Switch<BinaryLogLoadBalancer>;
+
 #endif
\ No newline at end of file
@@ -0,0 +1,315 @@
+/**
+ * @file Transport.cpp
+ * @brief Implementation of the socket transport and wire encoding.
+ *
+ * Provides little-endian encoding helpers and framed message exchange over
+ * TCP or Unix domain stream sockets using POSIX sockets.
+ */
+
+#include "Transport.h"
+#include <stdexcept>
+#include <cstring>
+#include <cerrno>
+#include <unistd.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+static const uint32_t MAX_FRAME_PAYLOAD = 64 * 1024 * 1024;
+
+void WireWriter::put8(uint8_t value) {
+    bytes.push_back(value);
+}
+
+void WireWriter::put16(uint16_t value) {
+    bytes.push_back(value & 0xFF);
+    bytes.push_back(value >> 8);
+}
+
+void WireWriter::put32(uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) {
+        bytes.push_back((value >> shift) & 0xFF);
+    }
+}
+
+void WireWriter::put64(uint64_t value) {
+    for (int shift = 0; shift < 64; shift += 8) {
+        bytes.push_back((value >> shift) & 0xFF);
+    }
+}
+
+void WireWriter::putBytes(const std::vector<uint8_t>& data) {
+    bytes.insert(bytes.end(), data.begin(), data.end());
+}
+
+const std::vector<uint8_t>& WireWriter::data() const {
+    return bytes;
+}
+
+void WireWriter::clear() {
+    bytes.clear();
+}
+
+WireReader::WireReader(const std::vector<uint8_t>& payload) : bytes(payload) {
+    position = 0;
+}
+
+void WireReader::require(size_t count) const {
+    if (bytes.size() - position < count) {
+        throw std::runtime_error("truncated message");
+    }
+}
+
+uint8_t WireReader::get8() {
+    require(1);
+    return bytes[position++];
+}
+
+uint16_t WireReader::get16() {
+    require(2);
+    uint16_t value = bytes[position] | (bytes[position + 1] << 8);
+    position += 2;
+    return value;
+}
+
+uint32_t WireReader::get32() {
+    require(4);
+    uint32_t value = 0;
+    for (int i = 3; i >= 0; --i) {
+        value = (value << 8) | bytes[position + i];
+    }
+    position += 4;
+    return value;
+}
+
+uint64_t WireReader::get64() {
+    require(8);
+    uint64_t value = 0;
+    for (int i = 7; i >= 0; --i) {
+        value = (value << 8) | bytes[position + i];
+    }
+    position += 8;
+    return value;
+}
+
+/**
+ * @brief Throws a runtime_error describing the current errno.
+ */
+static void throwSystemError(const std::string& what) {
+    throw std::runtime_error(what + ": " + std::strerror(errno));
+}
+
+/**
+ * @brief Resolved socket address for an endpoint string.
+ */
+struct Endpoint {
+    int family;
+    sockaddr_storage address;
+    socklen_t length;
+    std::string unixPath;   ///< Socket file for Unix endpoints, empty for TCP
+};
+
+/**
+ * @brief Parses "unix:/path" or "tcp:host:port" into a socket address.
+ */
+static Endpoint resolveEndpoint(const std::string& endpoint, bool passive) {
+    Endpoint result;
+    std::memset(&result.address, 0, sizeof(result.address));
+
+    if (endpoint.compare(0, 5, "unix:") == 0) {
+        std::string path = endpoint.substr(5);
+        sockaddr_un* address = reinterpret_cast<sockaddr_un*>(&result.address);
+        if (path.empty() || path.size() >= sizeof(address->sun_path)) {
+            throw std::runtime_error("bad unix socket path in endpoint '" + endpoint + "'");
+        }
+        address->sun_family = AF_UNIX;
+        std::strcpy(address->sun_path, path.c_str());
+        result.family = AF_UNIX;
+        result.length = sizeof(sockaddr_un);
+        result.unixPath = path;
+        return result;
+    }
+
+    size_t colon = endpoint.rfind(':');
+    if (endpoint.compare(0, 4, "tcp:") != 0 || colon <= 4) {
+        throw std::runtime_error("bad endpoint '" + endpoint + "' (expected unix:/path or tcp:host:port)");
+    }
+    std::string host = endpoint.substr(4, colon - 4);
+    std::string port = endpoint.substr(colon + 1);
+
+    addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = passive ? AI_PASSIVE : 0;
+    addrinfo* found = nullptr;
+    int status = getaddrinfo(host.c_str(), port.c_str(), &hints, &found);
+    if (status != 0) {
+        throw std::runtime_error("cannot resolve '" + endpoint + "': " + gai_strerror(status));
+    }
+    result.family = found->ai_family;
+    std::memcpy(&result.address, found->ai_addr, found->ai_addrlen);
+    result.length = found->ai_addrlen;
+    freeaddrinfo(found);
+    return result;
+}
+
+/**
+ * @brief Removes a Unix socket left at a path, leaving any other file alone.
+ *
+ * @return bool False if something other than a socket exists at the path
+ */
+static bool unlinkIfSocket(const std::string& path) {
+    struct stat info;
+    if (lstat(path.c_str(), &info) != 0) {
+        return true;
+    }
+    if (!S_ISSOCK(info.st_mode)) {
+        return false;
+    }
+    unlink(path.c_str());
+    return true;
+}
+
+/**
+ * @brief Disables Nagle's algorithm so small window frames are not delayed.
+ */
+static void setNoDelay(int fd, int family) {
+    if (family != AF_UNIX) {
+        int on = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    }
+}
+
+Connection::Connection(int socketFd) {
+    fd = socketFd;
+}
+
+Connection::~Connection() {
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+Connection* Connection::connectTo(const std::string& endpoint, int timeoutMs) {
+    Endpoint target = resolveEndpoint(endpoint, false);
+    const int retryDelayMs = 50;
+
+    for (int waited = 0; ; waited += retryDelayMs) {
+        int fd = socket(target.family, SOCK_STREAM, 0);
+        if (fd < 0) {
+            throwSystemError("socket");
+        }
+        if (connect(fd, reinterpret_cast<sockaddr*>(&target.address), target.length) == 0) {
+            setNoDelay(fd, target.family);
+            return new Connection(fd);
+        }
+        int error = errno;
+        close(fd);
+        // the node may still be starting up
+        bool retryable = error == ECONNREFUSED || error == ENOENT;
+        if (!retryable || waited >= timeoutMs) {
+            errno = error;
+            throwSystemError("connect to " + endpoint);
+        }
+        usleep(retryDelayMs * 1000);
+    }
+}
+
+Connection* Connection::acceptOne(const std::string& endpoint) {
+    Endpoint local = resolveEndpoint(endpoint, true);
+
+    int listener = socket(local.family, SOCK_STREAM, 0);
+    if (listener < 0) {
+        throwSystemError("socket");
+    }
+    if (!local.unixPath.empty()) {
+        if (!unlinkIfSocket(local.unixPath)) {
+            close(listener);
+            throw std::runtime_error("listen on " + endpoint + ": path exists and is not a socket");
+        }
+    } else {
+        int on = 1;
+        setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    }
+    if (bind(listener, reinterpret_cast<sockaddr*>(&local.address), local.length) != 0 || listen(listener, 1) != 0) {
+        int error = errno;
+        close(listener);
+        errno = error;
+        throwSystemError("listen on " + endpoint);
+    }
+
+    int fd = accept(listener, nullptr, nullptr);
+    int error = errno;
+    close(listener);
+    if (!local.unixPath.empty()) {
+        unlinkIfSocket(local.unixPath);
+    }
+    if (fd < 0) {
+        errno = error;
+        throwSystemError("accept on " + endpoint);
+    }
+    setNoDelay(fd, local.family);
+    return new Connection(fd);
+}
+
+void Connection::sendAll(const uint8_t* data, size_t count) {
+    while (count > 0) {
+        ssize_t sent = send(fd, data, count, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throwSystemError("send");
+        }
+        data += sent;
+        count -= sent;
+    }
+}
+
+void Connection::recvAll(uint8_t* data, size_t count) {
+    while (count > 0) {
+        ssize_t received = recv(fd, data, count, 0);
+        if (received < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throwSystemError("recv");
+        }
+        if (received == 0) {
+            throw std::runtime_error("connection closed by peer");
+        }
+        data += received;
+        count -= received;
+    }
+}
+
+void Connection::sendFrame(uint8_t type, const std::vector<uint8_t>& payload) {
+    uint32_t length = payload.size();
+    uint8_t header[5] = {
+        type,
+        (uint8_t)(length & 0xFF), (uint8_t)((length >> 8) & 0xFF),
+        (uint8_t)((length >> 16) & 0xFF), (uint8_t)(length >> 24)
+    };
+    sendAll(header, sizeof(header));
+    if (length > 0) {
+        sendAll(payload.data(), length);
+    }
+}
+
+uint8_t Connection::recvFrame(std::vector<uint8_t>& payload) {
+    uint8_t header[5];
+    recvAll(header, sizeof(header));
+    uint32_t length = header[1] | (header[2] << 8) | (header[3] << 16) | ((uint32_t)header[4] << 24);
+    if (length > MAX_FRAME_PAYLOAD) {
+        throw std::runtime_error("frame too large");
+    }
+    payload.resize(length);
+    if (length > 0) {
+        recvAll(payload.data(), length);
+    }
+    return header[0];
+}
@@ -0,0 +1,147 @@
+#ifndef TRANSPORT_H
+#define TRANSPORT_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Message types exchanged between a DistributedSwitch and its LB nodes.
+ *
+ * Every frame on the wire is a 1-byte type, a 4-byte little-endian payload
+ * length, then the payload. All integers in payloads are little-endian.
+ */
+enum MessageType : uint8_t {
+    /// Switch -> node. u64 windowStart, u32 windowLength, u32 count, then count
+    /// requests of u16 cycleOffset, u32 ipIn, u32 ipOut, u16 timeRequired, u8 jobType.
+    /// Promises that no further requests will arrive for cycles before
+    /// windowStart + windowLength, so the node may simulate up to there.
+    MSG_WINDOW = 1,
+    /// Node -> switch. u64 windowEnd: the node has simulated every cycle before windowEnd.
+    MSG_WINDOW_DONE = 2,
+    /// Switch -> node. u64 totalCycles: print the summary and report back.
+    MSG_FINISH = 3,
+    /// Node -> switch. u64 processed, u64 blocked, u32 finalServers, u64 queueSize.
+    MSG_SUMMARY = 4
+};
+
+/**
+ * @brief Appends little-endian integers to a byte buffer.
+ */
+class WireWriter {
+private:
+    std::vector<uint8_t> bytes;     ///< Encoded data
+
+public:
+    void put8(uint8_t value);
+    void put16(uint16_t value);
+    void put32(uint32_t value);
+    void put64(uint64_t value);
+    void putBytes(const std::vector<uint8_t>& data);
+
+    /**
+     * @brief Returns the encoded bytes.
+     */
+    const std::vector<uint8_t>& data() const;
+
+    /**
+     * @brief Discards the encoded bytes, keeping the allocation.
+     */
+    void clear();
+};
+
+/**
+ * @brief Reads little-endian integers from a received payload.
+ *
+ * Throws std::runtime_error if a read runs past the end of the payload.
+ */
+class WireReader {
+private:
+    const std::vector<uint8_t>& bytes;  ///< Payload being decoded
+    size_t position;                    ///< Offset of the next unread byte
+
+    /**
+     * @brief Checks that count more bytes are available.
+     */
+    void require(size_t count) const;
+
+public:
+    explicit WireReader(const std::vector<uint8_t>& payload);
+    uint8_t get8();
+    uint16_t get16();
+    uint32_t get32();
+    uint64_t get64();
+};
+
+/**
+ * @brief A connected stream socket (TCP or Unix domain) carrying framed messages.
+ *
+ * Endpoints are written as "unix:/path/to/socket" or "tcp:host:port". Socket
+ * errors and protocol violations throw std::runtime_error.
+ */
+class Connection {
+private:
+    int fd;     ///< Socket file descriptor, -1 once closed
+
+    /**
+     * @brief Sends exactly count bytes.
+     */
+    void sendAll(const uint8_t* data, size_t count);
+
+    /**
+     * @brief Receives exactly count bytes.
+     */
+    void recvAll(uint8_t* data, size_t count);
+
+public:
+    /**
+     * @brief Takes ownership of an already connected socket.
+     */
+    explicit Connection(int socketFd);
+
+    /**
+     * @brief Closes the socket.
+     */
+    ~Connection();
+
+    Connection(const Connection&) = delete;
+    Connection& operator=(const Connection&) = delete;
+
+    /**
+     * @brief Connects to a listening node, retrying while it starts up.
+     *
+     * @param endpoint "unix:/path" or "tcp:host:port"
+     * @param timeoutMs How long to keep retrying a refused or missing endpoint
+     * @return Connection* A new connection owned by the caller
+     */
+    static Connection* connectTo(const std::string& endpoint, int timeoutMs);
+
+    /**
+     * @brief Listens on an endpoint and accepts a single connection.
+     *
+     * For Unix sockets, a stale socket file is replaced and removed again after
+     * the connection is accepted.
+     *
+     * @param endpoint "unix:/path" or "tcp:host:port" (use host 0.0.0.0 to accept remote peers)
+     * @return Connection* A new connection owned by the caller
+     */
+    static Connection* acceptOne(const std::string& endpoint);
+
+    /**
+     * @brief Sends one frame.
+     *
+     * @param type Message type
+     * @param payload Encoded payload
+     */
+    void sendFrame(uint8_t type, const std::vector<uint8_t>& payload);
+
+    /**
+     * @brief Receives one frame, blocking until it arrives.
+     *
+     * @param payload Receives the payload
+     * @return uint8_t The message type
+     */
+    uint8_t recvFrame(std::vector<uint8_t>& payload);
+};
+
+#endif
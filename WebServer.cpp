@@ -1,7 +1,7 @@
 /**
  * @file WebServer.cpp
  * @brief Implementation of the WebServer class.
- * 
+ *
  * Provides methods for managing individual web server state, request assignment,
  * and incremental request processing in the load balancing simulation.
  */
@@ -11,6 +11,19 @@
 WebServer::WebServer() {
     isBusy = false;
     remainingTime = 0;
+    serverId = 0;
+    classIndex = 0;
+    speed = 1.0;
+    slot = -1;
+}
+
+WebServer::WebServer(int id, int serverClass, double serverSpeed) {
+    isBusy = false;
+    remainingTime = 0;
+    serverId = id;
+    classIndex = serverClass;
+    speed = serverSpeed;
+    slot = -1;
 }
 
 bool WebServer::isIdle() const {
@@ -23,11 +36,42 @@ void WebServer::assignRequest(const Request& req) {
     remainingTime = req.timeRequired;
 }
 
-void WebServer::process() {
-    if (isBusy) {
-        remainingTime--;
-        if (remainingTime <= 0) {
-            isBusy = false;
-        }
+double WebServer::process() {
+    if (!isBusy) {
+        return 0;
+    }
+    // repeated subtraction of a fractional speed leaves rounding residue, so a
+    // request within a hair of one cycle's work finishes this cycle
+    if (remainingTime <= speed * (1 + 1e-9)) {
+        double done = remainingTime;
+        isBusy = false;
+        remainingTime = 0;
+        return done;
     }
-}
\ No newline at end of file
+    remainingTime -= speed;
+    return speed;
+}
+
+int WebServer::getId() const {
+    return serverId;
+}
+
+int WebServer::getClassIndex() const {
+    return classIndex;
+}
+
+double WebServer::getSpeed() const {
+    return speed;
+}
+
+int WebServer::getSlot() const {
+    return slot;
+}
+
+void WebServer::setSlot(int position) {
+    slot = position;
+}
+
+double WebServer::getRemainingTime() const {
+    return remainingTime;
+}
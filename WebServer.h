@@ -5,50 +5,102 @@
 
 /**
  * @brief Represents a single web server in the load balancing system.
- * 
+ *
  * A WebServer processes incoming requests one at a time. Each server has a busy/idle state
- * and tracks the remaining processing time for its current request. Servers are managed by
- * LoadBalancer instances and contribute to overall system throughput.
+ * and tracks the remaining processing time for its current request. Servers belong to a
+ * ServerClass whose speed determines how much of a request is completed per clock cycle.
+ * Servers are managed by LoadBalancer instances and contribute to overall system throughput.
  */
 class WebServer
 {
 private:
     bool isBusy;              ///< Indicates whether the server is currently processing a request
-    int remainingTime;        ///< Clock cycles remaining to complete the current request
+    double remainingTime;     ///< Units of request time remaining to complete the current request
     Request currentRequest;   ///< The request currently being processed
+    int serverId;             ///< Identifier unique within the owning load balancer
+    int classIndex;           ///< Index of this server's class in the owning load balancer's fleet
+    double speed;             ///< Units of request time processed per clock cycle
+    int slot;                 ///< Position in the owning load balancer's server pool
 public:
     /**
      * @brief Constructs a new WebServer in an idle state.
-     * 
+     *
      * Initializes the server with no active requests and zero remaining time.
+     * The server runs at unit speed and belongs to class 0.
      */
     WebServer();
-    
+
+    /**
+     * @brief Constructs a new idle WebServer belonging to a server class.
+     *
+     * @param id Identifier unique within the owning load balancer
+     * @param serverClass Index of the server's class in the load balancer's fleet
+     * @param serverSpeed Units of request time processed per clock cycle
+     */
+    WebServer(int id, int serverClass, double serverSpeed);
+
     /**
      * @brief Checks if the server is available to accept new requests.
-     * 
+     *
      * @return true if the server is idle and can accept a new request
      * @return false if the server is currently processing a request
      */
     bool isIdle() const;
-    
+
     /**
      * @brief Assigns a new request to this server for processing.
-     * 
+     *
      * Marks the server as busy and sets the remaining processing time based on
      * the request's time requirements. Should only be called when server is idle.
-     * 
+     *
      * @param req The request to be processed by this server
      */
     void assignRequest(const Request& req);
-    
+
     /**
      * @brief Processes the current request for one clock cycle.
-     * 
-     * Decrements the remaining time counter. When remaining time reaches zero,
-     * the server automatically transitions back to idle state. This method should
-     * be called once per simulation cycle.
+     *
+     * Decrements the remaining time counter by the server's speed. When remaining
+     * time reaches zero, the server automatically transitions back to idle state.
+     * This method should be called once per simulation cycle.
+     *
+     * @return double Units of request time completed this cycle (0 when idle)
+     */
+    double process();
+
+    /**
+     * @brief Returns the server's identifier within its load balancer.
+     */
+    int getId() const;
+
+    /**
+     * @brief Returns the index of the server's class in its load balancer's fleet.
+     */
+    int getClassIndex() const;
+
+    /**
+     * @brief Returns the units of request time processed per clock cycle.
+     */
+    double getSpeed() const;
+
+    /**
+     * @brief Returns the server's position in its load balancer's pool.
+     */
+    int getSlot() const;
+
+    /**
+     * @brief Records the server's position in its load balancer's pool.
+     *
+     * Lets the load balancer remove a server in O(1) by swapping it with the
+     * last entry of the pool.
+     *
+     * @param position Index of the server in the pool
+     */
+    void setSlot(int position);
+
+    /**
+     * @brief Returns the units of request time left on the current request.
      */
-    void process();
+    double getRemainingTime() const;
 };
-#endif
\ No newline at end of file
+#endif
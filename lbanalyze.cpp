@@ -0,0 +1,199 @@
+/**
+ * @file lbanalyze.cpp
+ * @brief Offline analyzer for binary event logs written by the simulator.
+ *
+ * Streams an event log produced with `loadbalancer --events FILE` and prints,
+ * for every load balancer in the log:
+ * - the scaling timeline (every server added or removed)
+ * - dispatched and completed requests per fixed-size cycle interval
+ * - a run summary matching the simulator's own summary
+ *
+ * The log is read in blocks, so logs far larger than memory can be analyzed and
+ * analysis can be re-run without re-simulating.
+ *
+ * Usage: lbanalyze <events.bin> [intervalCycles]   (default interval: 1000)
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <map>
+#include <vector>
+#include <string>
+#include <limits>
+#include <algorithm>
+#include "EventLog.h"
+
+/**
+ * @brief Totals accumulated for one load balancer while streaming the log.
+ */
+struct LBStats {
+    char type = '?';                        ///< 'S' or 'P', from the queue start or run end record
+    uint64_t startingQueue = 0;             ///< Initial queue size
+    uint64_t dispatched = 0;                ///< Requests assigned to servers
+    uint64_t completed = 0;                 ///< Requests finished by servers
+    uint64_t blocked = 0;                   ///< Requests dropped by the firewall
+    uint64_t scaleUps = 0;                  ///< Servers added by scaling
+    uint64_t scaleDowns = 0;                ///< Servers removed by scaling
+    uint32_t finalServers = 0;              ///< Server count at run end (or after the last scaling event)
+    uint32_t lowerTaskTime = std::numeric_limits<uint32_t>::max();  ///< Shortest dispatched request
+    uint32_t upperTaskTime = 0;             ///< Longest dispatched request
+    uint64_t totalCycles = 0;               ///< Run length from the run end record, else last cycle seen
+    std::vector<uint64_t> intervalDispatched;   ///< Dispatched requests per interval
+    std::vector<uint64_t> intervalCompleted;    ///< Completed requests per interval
+};
+
+/**
+ * @brief Returns a printable name for a load balancer.
+ */
+static std::string lbName(uint16_t id, const LBStats& stats) {
+    std::string name = "LB " + std::to_string(id);
+    if (stats.type == 'S') {
+        name += " (Streaming)";
+    } else if (stats.type == 'P') {
+        name += " (Processing)";
+    }
+    return name;
+}
+
+/**
+ * @brief Adds one to the counter for the interval containing a cycle.
+ *
+ * Simulation cycles are numbered from 1 (the clock advances before any work),
+ * so interval b covers cycles b * interval + 1 through (b + 1) * interval.
+ */
+static void countInInterval(std::vector<uint64_t>& counts, uint64_t cycle, uint64_t interval) {
+    size_t bucket = cycle > 0 ? (cycle - 1) / interval : 0;
+    if (bucket >= counts.size()) {
+        counts.resize(bucket + 1, 0);
+    }
+    counts[bucket]++;
+}
+
+/**
+ * @brief Entry point: streams the log and prints timeline, throughput, and summaries.
+ *
+ * @param argc Number of command-line arguments
+ * @param argv Array of command-line argument strings
+ * @return int Exit status (0 for success, 1 for bad arguments or unreadable log)
+ */
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <events.bin> [intervalCycles]\n";
+        return 1;
+    }
+    uint64_t interval = 1000;
+    if (argc > 2) {
+        long long value = std::atoll(argv[2]);
+        if (value <= 0) {
+            std::cerr << "intervalCycles must be positive\n";
+            return 1;
+        }
+        interval = value;
+    }
+
+    EventLogReader reader(argv[1]);
+    if (!reader.isOpen()) {
+        std::cerr << "lbanalyze: " << reader.error() << "\n";
+        return 1;
+    }
+
+    std::map<uint16_t, LBStats> lbs;
+    uint64_t records = 0;
+    EventRecord r;
+
+    std::cout << "===== Scaling Timeline =====\n";
+    while (reader.next(r)) {
+        records++;
+        LBStats& stats = lbs[r.lbId];
+        if (r.cycle > stats.totalCycles) {
+            stats.totalCycles = r.cycle;
+        }
+
+        switch (r.type) {
+            case EVENT_QUEUE_START:
+                stats.type = r.detail;
+                stats.startingQueue = r.payload;
+                break;
+            case EVENT_SCALE_UP:
+            case EVENT_SCALE_DOWN:
+                if (r.type == EVENT_SCALE_UP) {
+                    stats.scaleUps++;
+                } else {
+                    stats.scaleDowns++;
+                }
+                stats.finalServers = r.payload;
+                std::cout << "[Time " << r.cycle << "] " << lbName(r.lbId, stats) << ": Server "
+                          << (r.type == EVENT_SCALE_UP ? "added" : "removed") << " (class " << (int)r.detail
+                          << "). Total servers: " << r.payload << "\n";
+                break;
+            case EVENT_BLOCKED:
+                stats.blocked++;
+                break;
+            case EVENT_DISPATCHED:
+                stats.dispatched++;
+                if (r.payload < stats.lowerTaskTime) {
+                    stats.lowerTaskTime = r.payload;
+                }
+                if (r.payload > stats.upperTaskTime) {
+                    stats.upperTaskTime = r.payload;
+                }
+                countInInterval(stats.intervalDispatched, r.cycle, interval);
+                break;
+            case EVENT_COMPLETED:
+                stats.completed++;
+                countInInterval(stats.intervalCompleted, r.cycle, interval);
+                break;
+            case EVENT_RUN_END:
+                stats.type = r.detail;
+                stats.totalCycles = r.cycle;
+                stats.finalServers = r.payload;
+                break;
+            default:
+                std::cerr << "lbanalyze: skipping record " << records << " with unknown type " << (int)r.type << "\n";
+                break;
+        }
+    }
+
+    std::cout << "\n===== Throughput per " << interval << " Cycles (dispatched / completed) =====\n";
+    std::cout << std::setw(21) << "Cycles";
+    for (const auto& entry: lbs) {
+        std::cout << "  " << std::setw(28) << lbName(entry.first, entry.second);
+    }
+    std::cout << "\n";
+    size_t buckets = 0;
+    for (const auto& entry: lbs) {
+        buckets = std::max(buckets, std::max(entry.second.intervalDispatched.size(), entry.second.intervalCompleted.size()));
+    }
+    for (size_t b = 0; b < buckets; ++b) {
+        std::cout << std::setw(21) << (std::to_string(b * interval + 1) + "-" + std::to_string((b + 1) * interval));
+        for (const auto& entry: lbs) {
+            const LBStats& stats = entry.second;
+            uint64_t dispatched = b < stats.intervalDispatched.size() ? stats.intervalDispatched[b] : 0;
+            uint64_t completed = b < stats.intervalCompleted.size() ? stats.intervalCompleted[b] : 0;
+            std::cout << "  " << std::setw(28) << (std::to_string(dispatched) + " / " + std::to_string(completed));
+        }
+        std::cout << "\n";
+    }
+
+    for (const auto& entry: lbs) {
+        const LBStats& stats = entry.second;
+        std::cout << "\n===== " << lbName(entry.first, stats) << " Summary =====\n";
+        std::cout << "Starting Queue Size: " << stats.startingQueue << "\n";
+        std::cout << "Total Processed: " << stats.dispatched << "\n";
+        std::cout << "Total Completed: " << stats.completed << "\n";
+        std::cout << "Total Total Cycles: " << stats.totalCycles << "\n";
+        if (stats.totalCycles > 0) {
+            std::cout << "Throughput: " << (static_cast<double>(stats.dispatched) / stats.totalCycles * 100) << "%" << "\n";
+        }
+        std::cout << "Total Blocked (Firewall): " << stats.blocked << "\n";
+        if (stats.dispatched > 0) {
+            std::cout << "Dispatched Task Time Range: " << stats.lowerTaskTime << " to " << stats.upperTaskTime << " Clock Cycles" << "\n";
+        }
+        std::cout << "Servers Added / Removed: " << stats.scaleUps << " / " << stats.scaleDowns << "\n";
+        std::cout << "Final Server Count: " << stats.finalServers << "\n";
+    }
+
+    std::cout << "\nRecords read: " << records << "\n";
+    return 0;
+}
@@ -0,0 +1,121 @@
+/**
+ * @file lbbench.cpp
+ * @brief Benchmark of compile-time versus runtime-polymorphic load balancer policies.
+ *
+ * Runs the same workload through LoadBalancer (policies inlined at compile time)
+ * and PolymorphicLoadBalancer (the same policies behind virtual interfaces) and
+ * reports time per simulated cycle. Both runs use the same random seed and must
+ * process the same number of requests; the benchmark fails otherwise.
+ *
+ * Console output and per-event logging are suppressed during the timed runs so
+ * that the measurement covers the simulation loop rather than I/O.
+ *
+ * Usage: lbbench [numServers] [clockCycles] [repetitions]
+ * (defaults: 1000 servers, 20000 cycles, 3 repetitions; the best run is reported)
+ */
+
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+#include "LoadBalancer.h"
+#include "PolymorphicLoadBalancer.h"
+
+// the benchmark is the only user of the polymorphic build
+template class BasicLoadBalancer<VirtualDispatch, VirtualScaler, VirtualFirewall, VirtualQueue>;
+
+/**
+ * @brief Result of one timed simulation.
+ */
+struct BenchResult {
+    double seconds;     ///< Wall-clock time of the simulation loop
+    int processed;      ///< Requests assigned to servers, used to check both builds agree
+};
+
+/**
+ * @brief Runs one simulation with a given load balancer type.
+ *
+ * Requests arrive through addRequest(), as the Switch would deliver them, and
+ * the load balancer advances with runOneCycle(). Arrivals are drawn in order
+ * from a pre-generated pool so request generation stays out of the timing.
+ *
+ * @tparam LB Load balancer type to benchmark
+ * @param pool Pre-generated requests, reused round-robin
+ * @param numServers Starting server count
+ * @param cycles Number of cycles to simulate
+ * @return BenchResult Elapsed time and processed request count
+ */
+template <class LB>
+static BenchResult runOnce(const std::vector<Request>& pool, int numServers, int cycles) {
+    srand(412);
+    LB lb(numServers, 200, "/dev/null", 'P');
+    lb.generateInitialQueue();
+
+    size_t next = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < cycles; i++) {
+        // several arrivals per cycle keep the servers saturated
+        for (int j = 0; j < numServers / 10 + 1; j++) {
+            lb.addRequest(pool[next]);
+            next = next + 1 == pool.size() ? 0 : next + 1;
+        }
+        lb.runOneCycle();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    BenchResult result;
+    result.seconds = std::chrono::duration<double>(end - start).count();
+    result.processed = lb.getTotalProcessed();
+    return result;
+}
+
+/**
+ * @brief Runs a benchmark several times and keeps the fastest run.
+ */
+template <class LB>
+static BenchResult best(const std::vector<Request>& pool, int numServers, int cycles, int repetitions) {
+    BenchResult fastest = runOnce<LB>(pool, numServers, cycles);
+    for (int i = 1; i < repetitions; i++) {
+        BenchResult result = runOnce<LB>(pool, numServers, cycles);
+        if (result.seconds < fastest.seconds) {
+            fastest = result;
+        }
+    }
+    return fastest;
+}
+
+/**
+ * @brief Entry point: times both builds and prints the comparison.
+ *
+ * @param argc Number of command-line arguments
+ * @param argv Array of command-line argument strings
+ * @return int Exit status (0 for success, 1 if the builds disagree)
+ */
+int main(int argc, char* argv[]) {
+    int numServers = argc > 1 ? std::atoi(argv[1]) : 1000;
+    int cycles = argc > 2 ? std::atoi(argv[2]) : 20000;
+    int repetitions = argc > 3 ? std::atoi(argv[3]) : 3;
+
+    srand(412);
+    std::vector<Request> pool(65536);
+
+    // discard simulator console output while timing
+    std::streambuf* console = std::cout.rdbuf(nullptr);
+    BenchResult templated = best<LoadBalancer>(pool, numServers, cycles, repetitions);
+    BenchResult polymorphic = best<PolymorphicLoadBalancer>(pool, numServers, cycles, repetitions);
+    std::cout.rdbuf(console);
+    std::cout.clear();
+
+    std::cout << "Servers: " << numServers << ", Cycles: " << cycles << ", best of " << repetitions << "\n";
+    std::cout << "Templated policies:   " << templated.seconds * 1e3 << " ms ("
+              << templated.seconds * 1e9 / cycles << " ns/cycle), processed " << templated.processed << "\n";
+    std::cout << "Polymorphic policies: " << polymorphic.seconds * 1e3 << " ms ("
+              << polymorphic.seconds * 1e9 / cycles << " ns/cycle), processed " << polymorphic.processed << "\n";
+    std::cout << "Speedup: " << polymorphic.seconds / templated.seconds << "x\n";
+
+    if (templated.processed != polymorphic.processed) {
+        std::cerr << "Mismatch: builds processed different request counts\n";
+        return 1;
+    }
+    return 0;
+}
@@ -11,6 +11,21 @@
  * - argv[1]: Number of servers per load balancer (default: 10)
  * - argv[2]: Simulation duration in clock cycles (default: 10000)
  * - argv[3]: Scaling cooldown period in cycles (default: 200)
+ *
+ * Options (may appear anywhere after the program name):
+ * - --fleet SPEC: Heterogeneous fleet used by both load balancers, written as
+ *   name:speed:cost:affinity:count[,...]. Overrides the server count.
+ * - --streaming-fleet SPEC, --processing-fleet SPEC: Fleet for one load
+ *   balancer only, overriding --fleet for it.
+ * - --events FILE: Write a compact binary event log (read with lbanalyze)
+ *   instead of the per-event text logs.
+ *
+ * Distributed mode (each load balancer in its own process, possibly on another host):
+ * - --node TYPE ENDPOINT: Run only the 'S' or 'P' load balancer, serving a
+ *   switch that connects to ENDPOINT ("unix:/path" or "tcp:host:port").
+ * - --streaming-node ENDPOINT, --processing-node ENDPOINT: Run the switch,
+ *   forwarding requests to the two nodes.
+ * - --lookahead N: Cycles per synchronization window (default: 100).
  * 
  * The simulation tracks performance metrics including throughput, request blocking,
  * task time distributions, and dynamic server scaling behavior. Results are logged
@@ -20,8 +35,92 @@
 #include <iostream>
 #include <cstdlib>
 #include <ctime>
+#include <string>
+#include <stdexcept>
+#include <memory>
 #include "LoadBalancer.h"
+#include "ServerClass.h"
+#include "EventLog.h"
 #include "Switch.h"
+#include "LBNode.h"
+#include "DistributedSwitch.h"
+
+/**
+ * @brief Hosts one load balancer as a node of a distributed run.
+ *
+ * @tparam LB LoadBalancer, or BinaryLogLoadBalancer when a binary event log is written
+ * @param fleet Server classes to start with
+ * @param cooldown Scaling cooldown period in cycles
+ * @param nodeType 'S' for the streaming node, 'P' for the processing node
+ * @param endpoint Where to listen for the switch
+ * @param eventLog Binary event log, or nullptr
+ * @return int Exit status (0 for success)
+ */
+template <class LB>
+static int runNode(const std::vector<ServerClass>& fleet, int cooldown, char nodeType, const std::string& endpoint, EventLog* eventLog) {
+    LB nodeLB(fleet, cooldown, nodeType == 'S' ? "streaming_log.txt" : "processing_log.txt", nodeType);
+    nodeLB.setEventLog(eventLog, nodeType == 'S' ? 0 : 1);
+    nodeLB.generateInitialQueue();
+    std::cout << "Waiting for switch on " << endpoint << "\n";
+    try {
+        LBNode<LB> node(&nodeLB, endpoint);
+        node.serve();
+    } catch (const std::runtime_error& e) {
+        std::cerr << "Node error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Runs both load balancers in this process, driven by a Switch.
+ *
+ * @tparam LB LoadBalancer, or BinaryLogLoadBalancer when a binary event log is written
+ * @param streamingFleet Server classes the streaming load balancer starts with
+ * @param processingFleet Server classes the processing load balancer starts with
+ * @param cooldown Scaling cooldown period in cycles
+ * @param clockCycles Simulation duration in cycles
+ * @param eventLog Binary event log, or nullptr
+ */
+template <class LB>
+static void runLocal(const std::vector<ServerClass>& streamingFleet, const std::vector<ServerClass>& processingFleet,
+                     int cooldown, int clockCycles, EventLog* eventLog) {
+    LB streamingLB(streamingFleet, cooldown, "streaming_log.txt", 'S');
+    LB processingLB(processingFleet, cooldown, "processing_log.txt", 'P');
+
+    streamingLB.setEventLog(eventLog, 0);
+    processingLB.setEventLog(eventLog, 1);
+
+    streamingLB.generateInitialQueue();
+    processingLB.generateInitialQueue();
+
+    Switch<LB> networkSwitch(&streamingLB, &processingLB);
+    networkSwitch.run(clockCycles);
+}
+
+/**
+ * @brief Closes the binary event log, if any, and reports write failures.
+ *
+ * @return bool False if the log on disk is incomplete
+ */
+static bool closeEventLog(EventLog* eventLog, const std::string& eventLogName) {
+    if (eventLog != nullptr && !eventLog->close()) {
+        std::cerr << "Error writing event log " << eventLogName << " (disk full?); the log is incomplete\n";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Returns the number of servers a fleet starts with.
+ */
+static int fleetSize(const std::vector<ServerClass>& fleet) {
+    int servers = 0;
+    for (const ServerClass& serverClass: fleet) {
+        servers += serverClass.initialCount;
+    }
+    return servers;
+}
 
 /**
  * @brief Main function executing the load balancing simulation.
@@ -41,27 +140,148 @@ int main(int argc, char* argv[]) {
     int numServers = 10;
     int clockCycles = 10000;
     int wait_n_cycles = 200;
+    std::vector<ServerClass> fleet;
+    std::vector<ServerClass> streamingFleet;
+    std::vector<ServerClass> processingFleet;
+    std::string eventLogName;
+    char nodeType = 0;
+    std::string nodeEndpoint;
+    std::string streamingEndpoint;
+    std::string processingEndpoint;
+    int lookahead = 100;
+
+    int positional = 0;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.compare(0, 2, "--") == 0) {
+            int values;
+            if (arg == "--node") {
+                values = 2;
+            }
+            else if (arg == "--fleet" || arg == "--streaming-fleet" || arg == "--processing-fleet" || arg == "--events" || arg == "--streaming-node" ||
+                     arg == "--processing-node" || arg == "--lookahead") {
+                values = 1;
+            }
+            else {
+                std::cerr << "Unknown option " << arg << "\n";
+                return 1;
+            }
+            if (i + values >= argc) {
+                std::cerr << "Missing value for " << arg << "\n";
+                return 1;
+            }
+        }
+
+        if (arg == "--fleet" || arg == "--streaming-fleet" || arg == "--processing-fleet") {
+            std::vector<ServerClass>& target = arg == "--fleet" ? fleet : arg == "--streaming-fleet" ? streamingFleet : processingFleet;
+            try {
+                target = parseFleetSpec(argv[++i]);
+            } catch (const std::invalid_argument& e) {
+                std::cerr << "Invalid " << arg << ": " << e.what() << "\n";
+                return 1;
+            }
+        }
+        else if (arg == "--events") {
+            eventLogName = argv[++i];
+        }
+        else if (arg == "--node") {
+            nodeType = argv[++i][0];
+            nodeEndpoint = argv[++i];
+        }
+        else if (arg == "--streaming-node") {
+            streamingEndpoint = argv[++i];
+        }
+        else if (arg == "--processing-node") {
+            processingEndpoint = argv[++i];
+        }
+        else if (arg == "--lookahead") {
+            lookahead = std::atoi(argv[++i]);
+        }
+        else if (positional == 0) {
+            numServers = std::atoi(argv[i]);
+            positional++;
+        }
+        else if (positional == 1) {
+            clockCycles = std::atoi(argv[i]);
+            positional++;
+        }
+        else if (positional == 2) {
+            wait_n_cycles = std::atoi(argv[i]);
+            positional++;
+        }
+    }
 
-    if (argc > 1) {
-        numServers = std::atoi(argv[1]);
+    if (fleet.empty()) {
+        fleet.push_back(ServerClass("standard", 1.0, 1.0, 'A', numServers));
     }
-    if (argc > 2) {
-        clockCycles = std::atoi(argv[2]);
+    if (streamingFleet.empty()) {
+        streamingFleet = fleet;
     }
-    if (argc > 3) {
-        wait_n_cycles = std::atoi(argv[3]);
+    if (processingFleet.empty()) {
+        processingFleet = fleet;
     }
 
-    std::cout << "\n" << "Starting simulation with " << numServers << " servers for " << clockCycles << " clock cycles.\n\n";
+    if (!nodeEndpoint.empty() && nodeType != 'S' && nodeType != 'P') {
+        std::cerr << "--node type must be S or P\n";
+        return 1;
+    }
+    if (streamingEndpoint.empty() != processingEndpoint.empty()) {
+        std::cerr << "--streaming-node and --processing-node must be given together\n";
+        return 1;
+    }
+    if (lookahead < 1 || lookahead > 65535) {
+        std::cerr << "--lookahead must be between 1 and 65535\n";
+        return 1;
+    }
 
-    LoadBalancer streamingLB(numServers, wait_n_cycles, "streaming_log.txt", 'S');
-    LoadBalancer processingLB(numServers, wait_n_cycles, "processing_log.txt", 'P');
+    // declared before any load balancer so the log outlives every writer
+    std::unique_ptr<EventLog> eventLog;
+    if (!eventLogName.empty()) {
+        eventLog.reset(new EventLog(eventLogName));
+        if (!eventLog->isOpen()) {
+            std::cerr << "Cannot open event log " << eventLogName << "\n";
+            return 1;
+        }
+    }
 
-    streamingLB.generateInitialQueue();
-    processingLB.generateInitialQueue();
-    
-    Switch networkSwitch(&streamingLB, &processingLB);
-    networkSwitch.run(clockCycles, numServers);
+    // node of a distributed run: host one load balancer and let the switch drive it
+    if (!nodeEndpoint.empty()) {
+        const std::vector<ServerClass>& nodeFleet = nodeType == 'S' ? streamingFleet : processingFleet;
+        int status;
+        if (eventLog) {
+            status = runNode<BinaryLogLoadBalancer>(nodeFleet, wait_n_cycles, nodeType, nodeEndpoint, eventLog.get());
+        } else {
+            status = runNode<LoadBalancer>(nodeFleet, wait_n_cycles, nodeType, nodeEndpoint, nullptr);
+        }
+        return closeEventLog(eventLog.get(), eventLogName) ? status : 1;
+    }
+
+    // switch of a distributed run: load balancers live in the node processes
+    if (!streamingEndpoint.empty()) {
+        std::cout << "\n" << "Starting distributed simulation for " << clockCycles << " clock cycles.\n\n";
+        try {
+            RemoteLoadBalancer streamingNode(streamingEndpoint, 10000);
+            RemoteLoadBalancer processingNode(processingEndpoint, 10000);
+            DistributedSwitch networkSwitch(&streamingNode, &processingNode, lookahead);
+            networkSwitch.run(clockCycles);
+        } catch (const std::runtime_error& e) {
+            std::cerr << "Switch error: " << e.what() << "\n";
+            return 1;
+        }
+        return 0;
+    }
+
+    std::cout << "\n" << "Starting simulation with " << fleetSize(streamingFleet) << " streaming and "
+              << fleetSize(processingFleet) << " processing servers for " << clockCycles << " clock cycles.\n\n";
+
+    if (eventLog) {
+        runLocal<BinaryLogLoadBalancer>(streamingFleet, processingFleet, wait_n_cycles, clockCycles, eventLog.get());
+    } else {
+        runLocal<LoadBalancer>(streamingFleet, processingFleet, wait_n_cycles, clockCycles, nullptr);
+    }
+    if (!closeEventLog(eventLog.get(), eventLogName)) {
+        return 1;
+    }
 
     return 0;
-}
\ No newline at end of file
+}